@@ -3,7 +3,7 @@
 # Copyright (c) 2013-2023 Fidelity National Information		#
 # Services, Inc. and/or its subsidiaries. All rights reserved.	#
 #								#
-# Copyright (c) 2017-2025 YottaDB LLC and/or its subsidiaries.	#
+# Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries.	#
 # All rights reserved.						#
 #								#
 # Copyright (c) 2017-2018 Stephen L Johnson.			#
@@ -237,6 +237,8 @@ set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_file_name_to_id")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_file_name_to_id_t")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_fork_n_core")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_free")
+set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_get_multi_s")
+set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_get_multi_st")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_get_s")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_get_st")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_hiber_start")
@@ -253,10 +255,14 @@ set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_main_lang_init")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_malloc")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_message")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_message_t")
+set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_node_next_multi_s")
+set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_node_next_multi_st")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_node_next_s")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_node_next_st")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_node_previous_s")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_node_previous_st")
+set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_set_multi_s")
+set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_set_multi_st")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_set_s")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_set_st")
 set(libyottadb_link "${libyottadb_link} -Wl,-u,ydb_sig_dispatch")
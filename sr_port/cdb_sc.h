@@ -3,6 +3,9 @@
  * Copyright (c) 2001-2021 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
  *	This source code contains the intellectual property	*
  *	of its copyright holder(s), and is made available	*
  *	under a license.  If you do not know the terms of	*
@@ -90,6 +93,7 @@ MBSTART {															\
 		TAREF1(t_fail_hist_blk, t_tries) = ((block_id)BLK_NUM);								\
 		TAREF1(tp_fail_hist, t_tries) = (gv_namehead *)(((block_id)BLK_NUM & ~(-BLKS_PER_LMAP)) ? BLK_TARGET : NULL);	\
 		TAREF1(tp_fail_hist_reg, t_tries) = gv_cur_region;								\
+		assert((N) < ARRAYSIZE((CSD)->tp_cdb_sc_blkmod));								\
 		(CSD)->tp_cdb_sc_blkmod[(N)]++;											\
 		TREF(blkmod_fail_level) = (LEVEL);										\
 		TREF(blkmod_fail_type) = (N);											\
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2023 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2023 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -166,6 +166,7 @@ void remap_globals_to_one_region(gd_addr *addr, gd_region *reg)
 		addr->tab_ptr = (hash_table_mname *)malloc(SIZEOF(hash_table_mname));
 		init_hashtab_mname((hash_table_mname *)addr->tab_ptr, 0, HASHTAB_NO_COMPACT, HASHTAB_NO_SPARE_TABLE );
 	}
+	addr->gd_runtime->last_gvnh_reg = NULL;	/* the name to region mapping changes below */
 	/* Repoint all names to the target region */
 	for (i = 0; i < addr->n_maps; i++)
 		addr->maps[i].reg.addr = reg;
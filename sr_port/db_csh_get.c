@@ -3,6 +3,9 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
  *	This source code contains the intellectual property	*
  *	of its copyright holder(s), and is made available	*
  *	under a license.  If you do not know the terms of	*
@@ -24,6 +27,7 @@
 GBLREF sgmnt_addrs	*cs_addrs;
 GBLREF unsigned int	t_tries;
 GBLREF boolean_t	mu_reorg_process;
+GBLREF boolean_t	low_priority_reads;
 
 #define ENOUGH_TRIES_TO_FALL_BACK 17
 
@@ -78,9 +82,11 @@ cache_rec_ptr_t	db_csh_get(block_id block) /* block number to look up */
 				/* setting refer outside of crit may not prevent its replacement, but that's an
 				 * inefficiency, not a tragedy because of concurrency checks in t_end or tp_tend;
 				 * the real problem is to ensure that the cache_rec layout is such that this
-				 * assignment does not damage other fields.
+				 * assignment does not damage other fields. A $ydb_low_priority_reads process leaves
+				 * the bit alone so its accesses do not keep buffers in the cache on its behalf.
 				 */
-				cr->refer = TRUE;
+				if (!low_priority_reads)
+					cr->refer = TRUE;
 				return cr;
 			}
 			lcnt--;
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2023 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2024 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -393,6 +393,8 @@ void dse_dmp_fhead (void)
 		util_out_print("  TP blkmod t_qread                    !12UL", TRUE, csd->tp_cdb_sc_blkmod[tp_blkmod_t_qread]);
 		util_out_print("  TP blkmod tp_tend                    !12UL", TRUE, csd->tp_cdb_sc_blkmod[tp_blkmod_tp_tend]);
 		util_out_print("  TP blkmod tp_hist                    !12UL", TRUE, csd->tp_cdb_sc_blkmod[tp_blkmod_tp_hist]);
+		util_out_print("  TP blkmod tp_tend_precrit            !12UL", TRUE,
+				csd->tp_cdb_sc_blkmod[tp_blkmod_tp_tend_precrit]);
 	}
 	if (NEED_TO_DUMP("BG_TRC"))
 	{
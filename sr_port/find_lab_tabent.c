@@ -0,0 +1,45 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+#include "mdef.h"
+
+#include "gtm_string.h"
+#include <rtnhdr.h>	/* see HDR_FILE_INCLUDE_SYNTAX comment in mdef.h for why <> syntax is needed */
+
+/* Locate a label by (exact) name in a routine's label table. The table is sorted (see "find_line_addr") so this does a
+ * binary search instead of the linear scan the linker used to do for every external label reference it resolved.
+ *
+ * Parameters:
+ *   base	- first entry of the label table
+ *   top	- one past the last entry of the label table
+ *   name	- label name to look for
+ *
+ * Returns the matching label table entry or NULL if the label is not in the table.
+ */
+lab_tabent *find_lab_tabent(lab_tabent *base, lab_tabent *top, mident *name)
+{
+	lab_tabent	*ptr;
+	int		stat;
+
+	while (base < top)
+	{
+		ptr = base + ((top - base) / 2);
+		MIDENT_CMP(name, &ptr->lab_name, stat);
+		if (0 == stat)
+			return ptr;
+		if (0 < stat)
+			base = ptr + 1;
+		else
+			top = ptr;
+	}
+	return NULL;
+}
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2023 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2025 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -163,6 +163,7 @@ GBLDEF	boolean_t	wcs_noasyncio;		/* used in wcs_wtstart to disable asyncio in th
 GBLDEF	io_desc		*active_device;
 GBLDEF	bool		pin_shared_memory;
 GBLDEF	bool		hugetlb_shm_enabled;
+GBLDEF	boolean_t	low_priority_reads;	/* blocks this process reads are the first to be replaced in the global buffers */
 GBLDEF	bool		error_mupip,
 			file_backed_up,
 			gv_replopen_error,
@@ -345,6 +346,7 @@ GBLDEF	u_casemap_t 		gtm_strToTitle_ptr;		/* Function pointer for gtm_strToTitle
 GBLDEF	boolean_t		mu_reorg_process;		/* set to TRUE by MUPIP REORG */
 GBLDEF	boolean_t		mu_reorg_more_tries;		/* set to TRUE by MUPIP REORG / REORG -UPGRADE */
 GBLDEF	boolean_t		mu_reorg_in_swap_blk;		/* set to TRUE for the duration of the call to "mu_swap_blk" */
+GBLDEF	uint4			mu_reorg_progress_secs;		/* MUPIP REORG -PROGRESS reporting interval (0 if none) */
 GBLDEF	boolean_t		mu_rndwn_process;
 GBLDEF	gv_key			*gv_currkey_next_reorg;
 GBLDEF	gv_namehead		*reorg_gv_target;
@@ -786,6 +788,7 @@ GBLDEF	uint4		region_open_count;		/* Number of region "opens" we have executed *
 GBLDEF	uint4		ydb_blkupgrade_flag = UPGRADE_IF_NEEDED;	/* US1479867: DSE can manually upgrade a block */
 GBLDEF	boolean_t	disk_blk_read;
 GBLDEF	boolean_t	ydb_dbfilext_syslog_disable;	/* by default, log every file extension message */
+GBLDEF	uint4		ydb_db_extend_headroom;		/* # of extensions to preallocate past the end of a db file */
 GBLDEF	int4		cws_reorg_remove_index;			/* see mu_swap_blk.c for comments on the need for these two */
 GBLDEF	block_id	cws_reorg_remove_array[CWS_REORG_REMOVE_ARRAYSIZE];
 GBLDEF	uint4		log_interval;
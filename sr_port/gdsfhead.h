@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2023 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2025 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -1729,23 +1729,26 @@ enum tp_ntp_blkmod_type		/* used for accounting in cs_data->tp_cdb_sc_blkmod[] *
 	tp_blkmod_tp_tend,		/* =  3 */
 	tp_blkmod_tp_hist,		/* =  4 */
 	tp_blkmod_op_tcommit,		/* =  5 */
-	n_tp_blkmod_types,		/* =  6 */
+	tp_blkmod_tp_tend_precrit,	/* =  6 : must stay below ARRAYSIZE(cs_data->tp_cdb_sc_blkmod) */
+	n_tp_blkmod_types,		/* =  7 */
 	/* NON-TP transactions */
-	t_blkmod_nomod,			/* =  7 */
-	t_blkmod_gvcst_srch,		/* =  8 */
-	t_blkmod_gvcst_expand_key,	/* =  9 */
-	t_blkmod_t_qread,		/* = 10 */
-	t_blkmod_t_end1,		/* = 11 */
-	t_blkmod_t_end2,		/* = 12 */
-	t_blkmod_t_end3,		/* = 13 */
-	t_blkmod_t_end4,		/* = 14 */
+	t_blkmod_nomod,			/* =  8 */
+	t_blkmod_gvcst_srch,		/* =  9 */
+	t_blkmod_gvcst_expand_key,	/* = 10 */
+	t_blkmod_t_qread,		/* = 11 */
+	t_blkmod_t_end1,		/* = 12 */
+	t_blkmod_t_end2,		/* = 13 */
+	t_blkmod_t_end3,		/* = 14 */
+	t_blkmod_t_end4,		/* = 15 */
 	/* MUPIP specific */
-	t_blkmod_mu_clsce,		/* = 15 */
-	t_blkmod_mu_reduce_level,	/* = 16 */
-	t_blkmod_mu_split,		/* = 17 */
-	t_blkmod_mu_swap_blk,		/* = 18 */
-	t_blkmod_reorg_funcs,		/* = 19 */
-	n_nontp_blkmod_types		/* = 20 */
+	t_blkmod_mu_clsce,		/* = 16 */
+	t_blkmod_mu_reduce_level,	/* = 17 */
+	t_blkmod_mu_split,		/* = 18 */
+	t_blkmod_mu_swap_blk,		/* = 19 */
+	t_blkmod_reorg_funcs,		/* = 20 */
+	/* NON-TP transactions (added at the end so the values above stay the same) */
+	t_blkmod_t_end_precrit,		/* = 21 */
+	n_nontp_blkmod_types		/* = 22 */
 };
 
 /* Below is a list of macro bitmasks used to set the global variable "donot_commit". This variable should normally be 0.
@@ -2066,8 +2069,8 @@ typedef struct sgmnt_data_struct
 	int4		filler_n_tp_retries[12];		/* Now moved to TAB_GVSTATS_REC section */
 	int4		filler_n_tp_retries_conflicts[12];	/* Now moved to TAB_GVSTATS_REC section */
 	int4		tp_cdb_sc_blkmod[8];	/* Notes down the number of times each place got a cdb_sc_blkmod in tp.
-						 * Only first 4 array entries are updated now, but space is allocated
-						 * for 4 more if needed in the future. */
+						 * Indexed by the TP values of "enum tp_ntp_blkmod_type" (below
+						 * n_tp_blkmod_types), which leaves 1 entry free for the future. */
 	/************* JOURNALLING RELATED FIELDS ****************/
 	uint4		jnl_alq;
 	uint4		jnl_deq;
@@ -2542,6 +2545,9 @@ typedef struct gd_runtime
 {
 	struct gd_info			*thread_gdi;	/* has information on the multiplexing thread - only used on linux AIO */
 	struct jnlpool_addrs_struct	*jnlpool;	/* pointer to jnlpool corresponding to this gld if one exists */
+	struct gvnh_reg_struct		*last_gvnh_reg;	/* gvnh_reg of the global name most recently bound by "gv_bind_name"
+							 * using this gld. See GD_LAST_GVNH_REG macro for how it is used.
+							 */
 } gd_runtime_t;
 
 typedef struct	gd_addr_struct
@@ -3042,6 +3048,21 @@ enum split_dir
 	NEWREC_DIR_RIGHT,	/* new record went into the beginning of the right block after the split */
 };
 
+/* Value of the node "gvcst_get" last fetched outside of TP from a global. It is reused by a later fetch of the same node
+ * as long as no transaction has committed in the database since (see "gvcst_get" for the details).
+ */
+typedef struct	gvt_get_cache_struct
+{
+	trans_num	curr_tn;		/* csa->ti->curr_tn sampled before the node was read */
+	gv_key		*key;			/* key of the node; "key->end" is 0 if nothing is cached */
+	char		*val;			/* buffer holding the value of the node */
+	uint4		val_size;		/* allocated size of "val" */
+	uint4		val_len;		/* length of the value of the node */
+	uint4		onln_rlbk_cycle;	/* cnl->onln_rlbk_cycle sampled along with "curr_tn" */
+} gvt_get_cache;
+
+#define	GVT_GET_CACHE_VAL_ROUNDUP	64	/* "gvt_get_cache.val" is allocated in multiples of this many bytes */
+
 /* Any change to this structure should also have a corresponding [re]initialization in mupip_recover.c
  * in the code where we play the records in the forward phase i.e. go through each of the jnl_files
  * and within if (mur_options.update), initialize necessary fields of gv_target before proceeding with mur_forward().
@@ -3062,6 +3083,8 @@ typedef struct	gv_namehead_struct
 	gv_key		*prev_key;			/* Points to fully expanded previous key. Used by $zprevious.
 							 * Valid only if clue->end is non-zero.
 							 */
+	gvt_get_cache	*get_cache;			/* Last value fetched by "gvcst_get" outside of TP (mumps only) */
+	struct gvt_thread_clues_struct *thread_clues;	/* Clues stashed for SimpleThreadAPI threads (see gvt_thread_clue.h) */
 	boolean_t	noisolation;			/* whether isolation is turned on or off for this global */
 	GTM64_ONLY(char	filler_8byte_align0[4];)
 	block_id	root;				/* Root of global variable tree */
@@ -3149,6 +3172,27 @@ typedef struct	gvnh_reg_struct
 	uint4		ver;			/* Copy of collation library VERSION defined in GBLNAMES section of gbldir */
 } gvnh_reg_t;
 
+/* Sets GVNH_REG to the gvnh_reg of the global name most recently bound in the gld ADDR if VARNAME (an mstr holding an
+ * unsubscripted global name) is that same name and to NULL otherwise. M code typically references the same global many
+ * times in a row (e.g. SET X=^PAT(I,"NAME"),Y=^PAT(I,"DOB")) so this lets "op_gvname" reuse the hash code of the
+ * name and "gv_bind_name" skip the hash table lookup. The cache lives in the gld runtime structure so switching $ZGBLDIR
+ * or loading a new gld implicitly uses a different cache and "gd_rundown" frees it along with the gld.
+ */
+#define	GD_LAST_GVNH_REG(ADDR, VARNAME, GVNH_REG)								\
+MBSTART {													\
+	gvnh_reg_t	*lcl_gvnh_reg;										\
+	mname_entry	*lcl_gvent;										\
+														\
+	GVNH_REG = NULL;											\
+	if ((NULL != (ADDR)->gd_runtime) && (NULL != (lcl_gvnh_reg = (ADDR)->gd_runtime->last_gvnh_reg)))	\
+	{													\
+		lcl_gvent = &lcl_gvnh_reg->gvt->gvname;								\
+		if (((VARNAME).len == lcl_gvent->var_name.len)							\
+				&& (0 == memcmp((VARNAME).addr, lcl_gvent->var_name.addr, (VARNAME).len)))		\
+			GVNH_REG = lcl_gvnh_reg;								\
+	}													\
+} MBEND
+
 #define	GVNH_REG_INIT(ADDR, HASHTAB, GD_MAP, GVT, REG, GVNH_REG, TABENT)							\
 MBSTART {															\
 	boolean_t	added, gbl_spans_regions;										\
@@ -3,6 +3,9 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
  *	This source code contains the intellectual property	*
  *	of its copyright holder(s), and is made available	*
  *	under a license.  If you do not know the terms of	*
@@ -20,6 +23,9 @@
  * header used by memory management system) */
 #define BLKS_IN_KILL_SET	251
 
+/* Max # of kill sets whose blocks "gvcst_expand_free_subtree" sorts together and frees with one pass over the local bitmaps */
+#define KILL_SET_BATCH_MAX	8
+
 /* Note that currently GDS_MAX_BLK_BITS is 62. This 62 bit block field allows for a 4Exa GDS block database, but the
  * current actual maximum block size is limited by the size of the master map. */
 typedef struct
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2023 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2023 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -36,6 +36,7 @@
  */
 #define	MAX_GVKEY_PADDING_LEN	(MAX_NUM_SUBSC_LEN + 16)
 #define EXTEND_WARNING_FACTOR	3
+#define MAX_DB_EXTEND_HEADROOM	64	/* max # of extensions $ydb_db_extend_headroom can reserve past the end of a db file */
 /* Define macro to compute the maximum key size required in the gv_key structure based on the database's maximum key size.
  * Align it to 4-byte boundary as this macro is mostly used by targ_alloc which allocates 3 keys one for gv_target->clue,
  * one for gv_target->first_rec and one for gv_target->last_rec. The alignment ensures all 3 fields start at aligned boundary.
@@ -3,7 +3,7 @@
  * Copyright (c) 2004-2022 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2024 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -76,6 +76,7 @@ GBLREF	boolean_t	ydbSystemMalloc;	/* Use the system's malloc() instead of our ow
 GBLREF	boolean_t	certify_all_blocks;
 GBLREF	uint4		ydb_blkupgrade_flag;	/* controls whether dynamic block upgrade is attempted or not */
 GBLREF	boolean_t	ydb_dbfilext_syslog_disable;	/* control whether db file extension message is logged or not */
+GBLREF	uint4		ydb_db_extend_headroom;		/* # of extensions to preallocate past the end of a db file */
 GBLREF	uint4		ydb_max_sockets;	/* Maximum sockets in a socket device that can be created by this process */
 GBLREF	bool		undef_inhibit;
 GBLREF	uint4		outOfMemoryMitigateSize;	/* Reserve that we will freed to help cleanup if run out of memory */
@@ -91,6 +92,7 @@ GBLREF	size_t		zmalloclim;		/* ISV memory warning of MALLOCCRIT in bytes */
 GBLREF	boolean_t	malloccrit_issued;	/* MEMORY error limit set at time of MALLOCCRIT */
 GBLREF	bool		pin_shared_memory;	/* pin shared memory into physical memory on creation */
 GBLREF	bool		hugetlb_shm_enabled;	/* allocate shared memory backed by huge pages */
+GBLREF	boolean_t	low_priority_reads;	/* do not let our reads displace other processes' buffers */
 
 #ifdef DEBUG
 GBLREF	block_id	ydb_skip_bml_num;
@@ -140,6 +142,11 @@ void	gtm_env_init(void)
 		ret = ydb_logical_truth_value(YDBENVINDX_HUGETLB_SHM, FALSE, &is_defined);
 		if (is_defined)
 			hugetlb_shm_enabled = ret; /* if env var is not defined, hugetlb_shm_enabled takes the default value */
+		/* ydb_low_priority_reads environment/logical */
+		assert(FALSE == low_priority_reads);
+		ret = ydb_logical_truth_value(YDBENVINDX_LOW_PRIORITY_READS, FALSE, &is_defined);
+		if (is_defined)
+			low_priority_reads = ret; /* if env var is not defined, low_priority_reads takes the default value */
 		/* See if ydb_msgprefix is specified. If so store it in TREF(ydbmsgprefix).
 		 * Note: Default value is already stored in "gtm_threadgbl_init".
 		 * Do this initialization before most other variables so any error messages later issued in this module
@@ -284,6 +291,12 @@ void	gtm_env_init(void)
 		ret = ydb_logical_truth_value(YDBENVINDX_DBFILEXT_SYSLOG_DISABLE, FALSE, &is_defined);
 		if (is_defined)
 			ydb_dbfilext_syslog_disable = ret; /* if the logical is not defined, we want to take default value */
+		/* Initialize how many extensions' worth of disk space a database file extension reserves past the new end of
+		 * the file. Ignored (i.e. no reservation) if not defined or out of range.
+		 */
+		if ((tmsock = ydb_trans_numeric(YDBENVINDX_DB_EXTEND_HEADROOM, &is_defined, IGNORE_ERRORS_TRUE, NULL))
+							&& (MAX_DB_EXTEND_HEADROOM >= tmsock)) /* Note assignment!! */
+			ydb_db_extend_headroom = tmsock;
 		/* Initialize maximum sockets in a single socket device createable by this process */
 		ydb_max_sockets = MAX_N_SOCKET;
 		if ((tmsock = ydb_trans_numeric(YDBENVINDX_MAX_SOCKETS, &is_defined, IGNORE_ERRORS_TRUE, NULL))
@@ -294,6 +307,11 @@ void	gtm_env_init(void)
 											IGNORE_ERRORS_TRUE, NULL);
 		if (0 > TREF(ydb_socket_keepalive_idle))
 			TREF(ydb_socket_keepalive_idle) = 0;
+		/* Initialize the number of sockets in a device at which WRITE /WAIT switches from poll() to epoll (0 disables) */
+		TREF(ydb_socket_epoll_threshold) = ydb_trans_numeric(YDBENVINDX_SOCKET_EPOLL_THRESHOLD, &is_defined,
+											IGNORE_ERRORS_TRUE, NULL);
+		if (0 > TREF(ydb_socket_epoll_threshold))
+			TREF(ydb_socket_epoll_threshold) = 0;
 		/* Initialize storage to allocate and keep in our back pocket in case run out of memory */
 		outOfMemoryMitigateSize = GTM_MEMORY_RESERVE_DEFAULT;
 		reservesize = ydb_trans_numeric(YDBENVINDX_MEMORY_RESERVE, &is_defined, IGNORE_ERRORS_TRUE, NULL);
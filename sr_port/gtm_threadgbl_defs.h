@@ -3,7 +3,7 @@
  * Copyright (c) 2010-2023 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2025 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -175,6 +175,7 @@ THREADGBLDEF(in_gvcst_bmp_mark_free,		boolean_t)			/* May need to skip online ro
 THREADGBLDEF(in_gvcst_redo_root_search,		boolean_t)			/* TRUE if gvcst_redo_root_search is in C-stack */
 THREADGBLDEF(in_op_gvget,			boolean_t)			/* TRUE if op_gvget() is a C-stack call ancestor */
 THREADGBLDEF(issue_DBROLLEDBACK_anyways,	boolean_t)			/* currently set by MUPIP LOAD */
+THREADGBLDEF(kill_set_batch,			kill_set *)			/* gvcst_expand_free_subtree working memory */
 THREADGBLDEF(last_fnquery_return_subcnt,	int)				/* count subscript in last_fnquery_return_sub */
 THREADGBLDEF(last_fnquery_return_varname,	mval)				/* returned varname of last $QUERY() */
 THREADGBLDEF(nontprestart_count,		uint4)				/* non-tp restart counter */
@@ -298,6 +299,7 @@ THREADGBLDEF(gvcst_statsDB_open_ch_active,	boolean_t)			/* Condition handler is
 THREADGBLDEF(in_zwrite,				boolean_t)			/* ZWrite is active */
 THREADGBLDEF(is_socketpool,			boolean_t)			/* True when device-to-be-opened is socketpool */
 THREADGBLDEF(ydb_socket_keepalive_idle,		int)				/* Initialized from $ydb_socket_keepalive_idle */
+THREADGBLDEF(ydb_socket_epoll_threshold,	int)				/* Initialized from $ydb_socket_epoll_threshold */
 THREADGBLDEF(in_mupip_integ,			boolean_t)			/* To let DO_DB_HDR_CHECK skip DBFLCORRP */
 THREADGBLDEF(instance_frozen_crit_skipped,	boolean_t)			/* To indicate Instance Freeze is on, CRIT skipped*/
 THREADGBLDEF(integ_cannotskip_crit,		boolean_t)			/* indicates whether a SKIP CRIT is allowed */
@@ -353,6 +355,8 @@ THREADGBLDEF(pipefifo_interrupt,		int)				/* count of number of times a pipe or
 										 * interrupted */
 THREADGBLDEF(prof_fp,				mprof_stack_frame *)		/* Stack frame that mprof currently operates on */
 THREADGBLDEF(relink_allowed,			int)				/* Non-zero if recursive relink permitted */
+THREADGBLDEF(rtn_unlink_cycle,			uint4)				/* Bumped by zr_unlink_rtn so callers caching routine
+										 * header/label addresses know to revalidate them */
 #ifdef AUTORELINK_SUPPORTED
 THREADGBLDEF(save_zhist,			zro_hist *)			/* Temp storage for zro_hist blk so condition hndler
 										 * can get a hold of it if necessary to free it */
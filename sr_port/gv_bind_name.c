@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2023 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -65,7 +65,12 @@ gvnh_reg_t *gv_bind_name(gd_addr *addr, mname_entry *gvname)
 
 	assert(MAX_MIDENT_LEN >= gvname->var_name.len);
 	tab_ptr = addr->tab_ptr;
-	if (NULL == (tabent = lookup_hashtab_mname((hash_table_mname *)tab_ptr, gvname)))
+	GD_LAST_GVNH_REG(addr, gvname->var_name, gvnh_reg);
+	if (NULL != gvnh_reg)
+	{	/* Same global name as the one last bound in this gld. No need for the hash table lookup. */
+		assert(gvnh_reg->gvt->gvname.hash_code == gvname->hash_code);
+		tabent = NULL;
+	} else if (NULL == (tabent = lookup_hashtab_mname((hash_table_mname *)tab_ptr, gvname)))
 	{
 		count = tab_ptr->count;	/* Note down current # of valid entries in hash table */
 		map = gv_srch_map(addr, gvname->var_name.addr, gvname->var_name.len, SKIP_BASEDB_OPEN_FALSE);
@@ -98,13 +103,14 @@ gvnh_reg_t *gv_bind_name(gd_addr *addr, mname_entry *gvname)
 				tabent = lookup_hashtab_mname((hash_table_mname *)tab_ptr, gvname);
 		}
 	}
-	if (NULL == tabent)
+	if ((NULL == gvnh_reg) && (NULL == tabent))
 	{
 		tmp_gvt = targ_alloc(reg->max_key_size, gvname, reg);
 		GVNH_REG_INIT(addr, tab_ptr, map, tmp_gvt, reg, gvnh_reg, tabent);
 	} else
 	{
-		gvnh_reg = (gvnh_reg_t *)tabent->value;
+		if (NULL == gvnh_reg)
+			gvnh_reg = (gvnh_reg_t *)tabent->value;
 		assert(NULL != gvnh_reg);
 		reg = gvnh_reg->gd_reg;
 		if (!reg->open)
@@ -124,6 +130,8 @@ gvnh_reg_t *gv_bind_name(gd_addr *addr, mname_entry *gvname)
 		RTS_ERROR_CSA_ABT(csa, VARLSTCNT(10) ERR_KEY2BIG, 4, keylen + 2, (int4)reg->max_key_size,
 			REG_LEN_STR(reg), ERR_GVIS, 2, 1 + gvname->var_name.len, format_key);
 	}
+	if (NULL != addr->gd_runtime)
+		addr->gd_runtime->last_gvnh_reg = gvnh_reg;
 	gv_target = tmp_gvt;	/* now that any rts_error possibilities are all past us, it is safe to set gv_target.
 				 * Setting it before could cause gv_target and gv_currkey to get out of sync in case of
 				 * an error condition and fail asserts in mdb_condition_handler (for example).
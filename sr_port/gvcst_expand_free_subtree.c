@@ -3,6 +3,9 @@
  * Copyright (c) 2001-2023 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
  *	This source code contains the intellectual property	*
  *	of its copyright holder(s), and is made available	*
  *	under a license.  If you do not know the terms of	*
@@ -36,6 +39,7 @@
 #include "rc_cpt_ops.h"
 #include "wcs_phase2_commit_wait.h"
 #include "min_max.h"
+#include "memcoherency.h"
 
 GBLREF	gd_region		*gv_cur_region;
 GBLREF	inctn_opcode_t		inctn_opcode;
@@ -50,6 +54,8 @@ GBLREF	unsigned char		rdfail_detail;
 error_def(ERR_GVKILLFAIL);
 error_def(ERR_IGNBMPMRKFREE);
 
+STATICFNDCL void gvcst_free_kill_set_batch(kill_set *ks_first, kill_set *ks_last, int4 n_blks);
+
 void	gvcst_expand_free_subtree(kill_set *ks_head)
 {
 	blk_hdr_ptr_t		bp;
@@ -65,19 +71,19 @@ void	gvcst_expand_free_subtree(kill_set *ks_head)
 	rec_hdr_ptr_t		rp, rp1, rtop;
 	sgmnt_addrs		*csa;
 	sgmnt_data_ptr_t	csd;
-	trans_num		ret_tn;
-	uint4			bsiz, level, save_update_trans;
+	kill_set		*batch_ks;
+	int4			batch_blks, batch_sets;
+	uint4			bsiz, level;
 	unsigned char		temp_buff[MAX_DB_BLK_SIZE];
 	unsigned short		temp_ushort;
-#	ifdef DEBUG
-	uint4			save_dollar_tlevel;
-#	endif
 
 	csa = cs_addrs;
 	csd = cs_data;
 	/* If ever the following assert is removed, "flush_cache" shouldn't be set to FALSE unconditionally as it is now */
 	assert(!csd->dsid);	/* see related comment in gvcst_kill before the call to this routine */
 	assert(MAX_DB_BLK_SIZE >= cs_data->blk_size);
+	batch_ks = NULL;
+	batch_blks = batch_sets = 0;
 	for (ks = ks_head; NULL != ks; ks = ks->next_kill_set)
 	{
 		for (cnt = 0; cnt < ks->used; ++cnt)
@@ -85,66 +91,96 @@ void	gvcst_expand_free_subtree(kill_set *ks_head)
 			ksb = &ks->blk[cnt];
 			if (0 != ksb->level)
 			{
-				if (!(was_crit = csa->now_crit)) /* needed so t_qread does not return NULL below */
-					grab_crit_encr_cycle_sync(gv_cur_region, WS_13);
-#				ifdef UNIX
-				if (csa->onln_rlbk_cycle != csa->nl->onln_rlbk_cycle)
-				{	/* Concurrent online rollback. We don't want to continue with rest of the logic to add more
-					 * blocks to the kill-set and do the gvcst_bmp_mark_free. Return to the caller. Since we
-					 * haven't sync'ed the cycles, the next tranasction commit will detect the online rollback
-					 * and the restart logic will handle it appropriately.
+				bp = NULL;
+				was_crit = csa->now_crit;
+				if (!was_crit && !dollar_tlevel && (NULL == csa->encr_ptr))
+				{	/* Non-TP KILL. The subtree was detached from the tree by the phase 1 commit and its blocks are
+					 * not yet marked free so no other process can update, reuse or reach this block. A copy taken
+					 * without crit is therefore good as long as the buffer did not get reused for some other block
+					 * (or replaced by a newer twin) while we copied it. This avoids a crit grab per index block
+					 * which, for a KILL of a big subtree, otherwise holds up all other updaters in bursts. If any
+					 * of the checks below fail, fall back to reading the block in crit.
 					 */
-					rel_crit(gv_cur_region);
-					send_msg_csa(CSA_ARG(csa) VARLSTCNT(6) ERR_IGNBMPMRKFREE, 4, REG_LEN_STR(gv_cur_region),
-							DB_LEN_STR(gv_cur_region));
-					return;
+					blk = ksb->block;
+					if ((csa->onln_rlbk_cycle == csa->nl->onln_rlbk_cycle)
+						&& (NULL != (bp = (blk_hdr_ptr_t)t_qread(blk, (sm_int_ptr_t)&cycle, &cr))))
+					{
+						bsiz = MIN(bp->bsiz, MAX_DB_BLK_SIZE);	/* avoid buffer overflows */
+						memcpy(temp_buff, bp, bsiz);
+						SHM_READ_MEMORY_BARRIER;
+						if (((NULL != cr) && ((cr->cycle != cycle) || (cr->blk != blk) || cr->in_tend
+								|| (cr->twin && !cr->bt_index)))
+							|| (SIZEOF(blk_hdr) > bsiz) || (((blk_hdr_ptr_t)temp_buff)->bsiz != bsiz)
+							|| (0 == ((blk_hdr_ptr_t)temp_buff)->levl)
+							|| (csa->onln_rlbk_cycle != csa->nl->onln_rlbk_cycle))
+							bp = NULL;
+					}
 				}
-#				endif
-				if (dollar_tlevel && ksb->flag)
+				if (NULL != bp)
+					long_blk_id = IS_64_BLK_ID(temp_buff);
+				else
 				{
-					chain.flag = 1;
-					chain.next_off = 0;
-					assert(ksb->block < (1LL << CW_INDEX_MAX_BITS));
-					chain.cw_index = ksb->block;
-					assert(SIZEOF(chain) == SIZEOF(blk));
-					blk = ((block_ref *)&chain)->id;
-				} else
-					blk = ksb->block;
-				if (!(bp = (blk_hdr_ptr_t)t_qread(blk, (sm_int_ptr_t)&cycle, &cr)))
-				{	/* This should have worked because t_qread was done in crit */
-					RTS_ERROR_CSA_ABT(csa, VARLSTCNT(4) ERR_GVKILLFAIL, 2, 1, &rdfail_detail);
+					if (!was_crit) /* needed so t_qread does not return NULL below */
+						grab_crit_encr_cycle_sync(gv_cur_region, WS_13);
+#					ifdef UNIX
+					if (csa->onln_rlbk_cycle != csa->nl->onln_rlbk_cycle)
+					{	/* Concurrent online rollback. We don't want to continue with rest of the logic to add more
+						 * blocks to the kill-set and do the gvcst_bmp_mark_free. Return to the caller. Since we
+						 * haven't sync'ed the cycles, the next tranasction commit will detect the online rollback
+						 * and the restart logic will handle it appropriately.
+						 */
+						rel_crit(gv_cur_region);
+						send_msg_csa(CSA_ARG(csa) VARLSTCNT(6) ERR_IGNBMPMRKFREE, 4, REG_LEN_STR(gv_cur_region),
+								DB_LEN_STR(gv_cur_region));
+						return;
+					}
+#					endif
+					if (dollar_tlevel && ksb->flag)
+					{
+						chain.flag = 1;
+						chain.next_off = 0;
+						assert(ksb->block < (1LL << CW_INDEX_MAX_BITS));
+						chain.cw_index = ksb->block;
+						assert(SIZEOF(chain) == SIZEOF(blk));
+						blk = ((block_ref *)&chain)->id;
+					} else
+						blk = ksb->block;
+					if (!(bp = (blk_hdr_ptr_t)t_qread(blk, (sm_int_ptr_t)&cycle, &cr)))
+					{	/* This should have worked because t_qread was done in crit */
+						RTS_ERROR_CSA_ABT(csa, VARLSTCNT(4) ERR_GVKILLFAIL, 2, 1, &rdfail_detail);
+					}
+					long_blk_id = IS_64_BLK_ID(bp);
+					if (NULL != cr)
+					{	/* It is possible that t_qread returned a buffer from first_tp_srch_status.
+						 * In that case, t_qread does not wait for cr->in_tend to be zero since
+						 * there is no need to wait as long as all this is done inside of the TP
+						 * transaction. But the gvcst_expand_free_subtree logic is special in that it
+						 * is done AFTER the TP transaction is committed but with dollar_tlevel still
+						 * set to non-zero. So it is possible that cr->in_tend is non-zero in this case.
+						 * Hence we need to check if cr->in_tend is non-zero and if so wait for commit
+						 * to complete before scanning the block for child-block #s to free.
+						 */
+						if (dollar_tlevel && cr->in_tend)
+							wcs_phase2_commit_wait(csa, cr);
+						assert(!cr->twin || cr->bt_index);
+						assert((NULL == (bt = bt_get(blk)))
+							|| (CR_NOTVALID == bt->cache_index)
+							|| (cr == (cache_rec_ptr_t)GDS_REL2ABS(bt->cache_index)) && (0 == cr->in_tend));
+					}
+					assert(MAX_DB_BLK_SIZE >= bp->bsiz);
+					bsiz = MIN(bp->bsiz, MAX_DB_BLK_SIZE);	/* avoid buffer overflows */
+					memcpy(temp_buff, bp, bsiz);
+					if (!was_crit)
+						rel_crit(gv_cur_region);
 				}
-				long_blk_id = IS_64_BLK_ID(bp);
 				blk_id_sz = SIZEOF_BLK_ID(long_blk_id);
-				if (NULL != cr)
-				{	/* It is possible that t_qread returned a buffer from first_tp_srch_status.
-					 * In that case, t_qread does not wait for cr->in_tend to be zero since
-					 * there is no need to wait as long as all this is done inside of the TP
-					 * transaction. But the gvcst_expand_free_subtree logic is special in that it
-					 * is done AFTER the TP transaction is committed but with dollar_tlevel still
-					 * set to non-zero. So it is possible that cr->in_tend is non-zero in this case.
-					 * Hence we need to check if cr->in_tend is non-zero and if so wait for commit
-					 * to complete before scanning the block for child-block #s to free.
-					 */
-					if (dollar_tlevel && cr->in_tend)
-						wcs_phase2_commit_wait(csa, cr);
-					assert(!cr->twin || cr->bt_index);
-					assert((NULL == (bt = bt_get(blk)))
-						|| (CR_NOTVALID == bt->cache_index)
-						|| (cr == (cache_rec_ptr_t)GDS_REL2ABS(bt->cache_index)) && (0 == cr->in_tend));
-				}
-				assert(MAX_DB_BLK_SIZE >= bp->bsiz);
-				bsiz = MIN(bp->bsiz, MAX_DB_BLK_SIZE);	/* avoid buffer overflows */
-				memcpy(temp_buff, bp, bsiz);
-				if (!was_crit)
-					rel_crit(gv_cur_region);
 				for (rp = (rec_hdr_ptr_t)(temp_buff + SIZEOF(blk_hdr)), rtop = (rec_hdr_ptr_t)(temp_buff + bsiz);
 					rp < rtop; rp = rp1)
 				{
 					GET_USHORT(temp_ushort, &rp->rsiz);
 					rp1 = (rec_hdr_ptr_t)((sm_uc_ptr_t)rp + temp_ushort);
 					if ((sm_uc_ptr_t)rp1 < ((sm_uc_ptr_t)(rp + 1) + blk_id_sz))
-					{	/* This should have worked because a local copy was made while crit */
+					{	/* This should have worked because a validated local copy was made above */
 						assert(FALSE);
 						kill_error = cdb_sc_rmisalign;
 						RTS_ERROR_CSA_ABT(csa, VARLSTCNT(4) ERR_GVKILLFAIL, 2, 1, &kill_error);
@@ -171,19 +207,83 @@ void	gvcst_expand_free_subtree(kill_set *ks_head)
 					rc_cpt_entry(ksb->block);
 			}
 		}
-		gvcst_kill_sort(ks);
-		assert(!bml_save_dollar_tlevel);
-		DEBUG_ONLY(save_dollar_tlevel = dollar_tlevel);
-		bml_save_dollar_tlevel = dollar_tlevel;
-		/* Resetting and restoring of update_trans is necessary to avoid blowing an assert in t_begin that it is 0. */
-		save_update_trans = update_trans;
-		assert(1 >= dollar_tlevel);
-		dollar_tlevel = 0;	/* temporarily for gvcst_bmp_mark_free */
-		update_trans = 0;
-		GVCST_BMP_MARK_FREE(ks, ret_tn, inctn_invalid_op, inctn_bmp_mark_free_gtm, inctn_opcode, csa)
-		update_trans = save_update_trans;
-		dollar_tlevel = bml_save_dollar_tlevel;
-		assert(dollar_tlevel == save_dollar_tlevel);
-		bml_save_dollar_tlevel = 0;
+		/* Any index blocks in this kill set have been expanded above, adding their children to kill sets further
+		 * down the list. Rather than free the blocks of each kill set on its own (which, since a kill set holds
+		 * fewer blocks than a local bitmap maps and a big subtree is spread across many bitmaps, would update the
+		 * same bitmap once per kill set that has a block in it), free the blocks of a batch of kill sets together
+		 * so each bitmap is updated (one non-TP transaction and one INCTN journal record) at most once per batch.
+		 * The batch is kept small so a KILL interrupted before the blocks are freed abandons few more blocks than
+		 * it would have without batching.
+		 */
+		if (NULL == batch_ks)
+			batch_ks = ks;
+		batch_blks += ks->used;
+		if ((NULL != ks->next_kill_set) && (KILL_SET_BATCH_MAX > ++batch_sets))
+			continue;
+		gvcst_free_kill_set_batch(batch_ks, ks, batch_blks);
+		batch_ks = NULL;
+		batch_blks = batch_sets = 0;
+	}
+}
+
+/* Marks the blocks in the kill sets "ks_first" through "ks_last" ("n_blks" blocks in all) free in the local bitmaps */
+STATICFNDEF void gvcst_free_kill_set_batch(kill_set *ks_first, kill_set *ks_last, int4 n_blks)
+{
+	blk_ident		*blk;
+	kill_set		*ks, *batch;
+	sgmnt_addrs		*csa;
+	trans_num		ret_tn;
+	uint4			save_update_trans;
+#	ifdef DEBUG
+	uint4			save_dollar_tlevel;
+#	endif
+	DCL_THREADGBL_ACCESS;
+
+	SETUP_THREADGBL_ACCESS;
+	csa = cs_addrs;
+	if (ks_first == ks_last)
+	{
+		batch = ks_first;
+		gvcst_kill_sort(batch);
+	} else
+	{	/* Gather the blocks into one list. "gvcst_bmp_mark_free" only looks at the "used" and "blk[]" members of the
+		 * kill set so the list is a kill set with a "blk[]" array big enough to hold KILL_SET_BATCH_MAX kill sets.
+		 * It is allocated once and kept for the life of the process so an error in the middle of freeing does not
+		 * leak it.
+		 */
+		assert(KILL_SET_BATCH_MAX * BLKS_IN_KILL_SET >= n_blks);
+		batch = TREF(kill_set_batch);
+		if (NULL == batch)
+		{
+			batch = (kill_set *)malloc(SIZEOF(kill_set)
+							+ ((KILL_SET_BATCH_MAX - 1) * BLKS_IN_KILL_SET * SIZEOF(blk_ident)));
+			TREF(kill_set_batch) = batch;
+		}
+		batch->next_kill_set = NULL;
+		blk = &batch->blk[0];
+		for (ks = ks_first; ; ks = ks->next_kill_set)
+		{
+			assert(ks->used <= BLKS_IN_KILL_SET);
+			memcpy(blk, &ks->blk[0], ks->used * SIZEOF(blk_ident));
+			blk += ks->used;
+			if (ks == ks_last)
+				break;
+		}
+		batch->used = (int4)(blk - &batch->blk[0]);
+		assert(batch->used == n_blks);
+		gvcst_kill_sort_blks(&batch->blk[0], batch->used);
 	}
+	assert(!bml_save_dollar_tlevel);
+	DEBUG_ONLY(save_dollar_tlevel = dollar_tlevel);
+	bml_save_dollar_tlevel = dollar_tlevel;
+	/* Resetting and restoring of update_trans is necessary to avoid blowing an assert in t_begin that it is 0. */
+	save_update_trans = update_trans;
+	assert(1 >= dollar_tlevel);
+	dollar_tlevel = 0;	/* temporarily for gvcst_bmp_mark_free */
+	update_trans = 0;
+	GVCST_BMP_MARK_FREE(batch, ret_tn, inctn_invalid_op, inctn_bmp_mark_free_gtm, inctn_opcode, csa)
+	update_trans = save_update_trans;
+	dollar_tlevel = bml_save_dollar_tlevel;
+	assert(dollar_tlevel == save_dollar_tlevel);
+	bml_save_dollar_tlevel = 0;
 }
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2023 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -41,6 +41,7 @@
 #include "t_retry.h"
 #include "t_begin.h"
 #include "gvcst_protos.h"	/* for gvcst_search,gvcst_get prototype */
+#include "gvt_inline.h"		/* for GVKEY_INIT */
 
 /* needed for spanning nodes */
 #include "op.h"
@@ -49,6 +50,7 @@
 #include "tp_frame.h"
 #include "tp_restart.h"
 #include "gtmimagename.h"
+#include "memcoherency.h"
 
 LITREF	mval		literal_batch;
 LITREF	mstr		nsb_dummy;
@@ -75,10 +77,44 @@ boolean_t gvcst_get(mval *v)
 	sm_uc_ptr_t	sn_ptr;
 	int		debug_len;
 	int		save_dollar_tlevel;
+	boolean_t	use_cache;
+	gvt_get_cache	*cache;
+	trans_num	cache_tn;
+	uint4		cache_rlbk_cycle;
 	DCL_THREADGBL_ACCESS;
 
 	SETUP_THREADGBL_ACCESS;
 	DEBUG_ONLY(save_dollar_tlevel = dollar_tlevel);
+	/* Outside of TP, a node that was fetched by the previous call for this global can be returned again without going
+	 * to the database if no transaction has committed in the database since that fetch (curr_tn and the online rollback
+	 * cycle are both sampled BEFORE the fetch so a commit that races with it makes the cached value look stale, never
+	 * the other way around). This makes code that reads the same node twice in a row, e.g. "$GET(^X(A,B))" followed by
+	 * "$PIECE(^X(A,B),...)", only pay for one database search. Utilities are excluded as MUPIP JOURNAL RECOVER/ROLLBACK
+	 * can take curr_tn backwards while the process has the database open; statsDB regions are excluded as their
+	 * records are updated in place without a transaction.
+	 */
+	use_cache = (!dollar_tlevel && IS_MUMPS_IMAGE && !IS_STATSDB_CSA(cs_addrs));
+	if (use_cache)
+	{
+		cache_tn = cs_addrs->ti->curr_tn;
+		cache_rlbk_cycle = cs_addrs->nl->onln_rlbk_cycle;
+		SHM_READ_MEMORY_BARRIER;
+		cache = gv_target->get_cache;
+		if ((NULL != cache) && (cache->curr_tn == cache_tn) && (cache->onln_rlbk_cycle == cache_rlbk_cycle)
+			&& (cache->key->end == gv_currkey->end)
+			&& !memcmp(cache->key->base, gv_currkey->base, gv_currkey->end + 1))
+		{
+			DEBUG_ONLY(TREF(in_op_gvget) = FALSE;)	/* gvcst_get2 would have reset it */
+			ENSURE_STP_FREE_SPACE(cache->val_len);
+			memcpy(stringpool.free, cache->val, cache->val_len);
+			v->mvtype = MV_STR;
+			v->str.addr = (char *)stringpool.free;
+			v->str.len = cache->val_len;
+			stringpool.free += cache->val_len;
+			INCR_GVSTATS_COUNTER(cs_addrs, cs_addrs->nl, n_get, (gtm_uint64_t) 1);
+			return TRUE;
+		}
+	}
 	gotit = gvcst_get2(v, NULL);
 	INCR_GVSTATS_COUNTER(cs_addrs, cs_addrs->nl, n_get, (gtm_uint64_t) 1);
 	WBTEST_ONLY(WBTEST_QUERY_HANG,
@@ -158,6 +194,38 @@ boolean_t gvcst_get(mval *v)
 		gotit = gotspan || gotdummy;
 	}
 	assert(save_dollar_tlevel == dollar_tlevel);
+	if (use_cache)
+	{	/* Remember this node for the next call (see comment at the top). Values larger than a block are not kept. The
+		 * value buffer is only allocated for a value that is kept and grows with the longest such value of the global
+		 * so a process that touches many globals holding short values keeps only that much memory per global.
+		 */
+		cache = gv_target->get_cache;
+		if (NULL == cache)
+		{
+			cache = (gvt_get_cache *)malloc(SIZEOF(gvt_get_cache));
+			cache->key = NULL;
+			GVKEY_INIT(cache->key, gv_target->clue.top);
+			cache->val = NULL;
+			cache->val_size = 0;
+			gv_target->get_cache = cache;
+		}
+		cache->key->end = 0;		/* invalidate whatever was cached */
+		if (gotit && (v->str.len <= cs_addrs->hdr->blk_size) && (gv_currkey->end < cache->key->top))
+		{
+			if (cache->val_size < v->str.len)
+			{
+				if (NULL != cache->val)
+					free(cache->val);
+				cache->val_size = MIN(ROUND_UP2(v->str.len, GVT_GET_CACHE_VAL_ROUNDUP), cs_addrs->hdr->blk_size);
+				cache->val = (char *)malloc(cache->val_size);
+			}
+			memcpy(cache->val, v->str.addr, v->str.len);
+			cache->val_len = v->str.len;
+			cache->curr_tn = cache_tn;
+			cache->onln_rlbk_cycle = cache_rlbk_cycle;
+			COPY_KEY(cache->key, gv_currkey);
+		}
+	}
 	return gotit;
 }
 
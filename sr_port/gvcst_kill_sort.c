@@ -2,6 +2,9 @@
  *								*
  *	Copyright 2001, 2007 Fidelity Information Services, Inc	*
  *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
  *	This source code contains the intellectual property	*
  *	of its copyright holder(s), and is made available	*
  *	under a license.  If you do not know the terms of	*
@@ -17,6 +20,13 @@
 #define S_CUTOFF 15
 
 void gvcst_kill_sort(kill_set *k)
+{
+	assert(k->used <= BLKS_IN_KILL_SET);
+	gvcst_kill_sort_blks(k->blk, k->used);
+}
+
+/* Sorts an array of "used" blk_ident entries (which need not fit in one kill_set but do fit in KILL_SET_BATCH_MAX of them) */
+void gvcst_kill_sort_blks(blk_ident *blk, int4 used)
 {
 
 	block_id_ptr_t	stack[50],*sp;
@@ -24,10 +34,10 @@ void gvcst_kill_sort(kill_set *k)
 	block_id_ptr_t	l,r;
 	block_id_ptr_t	ix,jx,kx;
 
-	assert(k->used <= BLKS_IN_KILL_SET);
+	assert(used <= (KILL_SET_BATCH_MAX * BLKS_IN_KILL_SET));
 	sp = stack;
-	l = (block_id_ptr_t)(k->blk);
-	r = l + k->used-1;
+	l = (block_id_ptr_t)blk;
+	r = l + used-1;
 	for (;;)
 		if (r - l < S_CUTOFF)
 		{
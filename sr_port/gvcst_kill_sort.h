@@ -3,6 +3,9 @@
  * Copyright (c) 2001-2018 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
  *	This source code contains the intellectual property	*
  *	of its copyright holder(s), and is made available	*
  *	under a license.  If you do not know the terms of	*
@@ -14,6 +17,7 @@
 #define GVCST_KILL_SORT_H_INCLUDED
 
 void gvcst_kill_sort(kill_set *k);
+void gvcst_kill_sort_blks(blk_ident *blk, int4 used);
 
 #endif
 
@@ -2,6 +2,9 @@
  *								*
  *	Copyright 2001, 2008 Fidelity Information Services, Inc	*
  *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
  *	This source code contains the intellectual property	*
  *	of its copyright holder(s), and is made available	*
  *	under a license.  If you do not know the terms of	*
@@ -27,18 +30,24 @@ GBLREF zshow_out	*zwr_output;
 
 void gvzwr_out(void)
 {
-	int	n;
 	mval	val;
+
+	op_gvget(&val);
+	if (!MV_DEFINED(&val))
+		return;
+	gvzwr_out_val(&val);
+}
+
+/* Writes the node in gv_currkey with the value "val" that the caller already fetched */
+void gvzwr_out_val(mval *val)
+{
 	mval	outdesc;
 	mstr	one;
 	char	buff[MAX_ZWR_KEY_SZ], *end;
 
 	if ((end = (char *)format_targ_key((uchar_ptr_t)&buff[0], MAX_ZWR_KEY_SZ, gv_currkey, TRUE)) == 0)
 		end = &buff[MAX_ZWR_KEY_SZ - 1];
-	op_gvget(&val);
-	if (!MV_DEFINED(&val))
-		return;
-	MV_FORCE_STRD(&val);
+	MV_FORCE_STRD(val);
 	outdesc.mvtype = MV_STR;
 	outdesc.str.addr = &buff[0];
 	outdesc.str.len = INTCAST(end - outdesc.str.addr);
@@ -47,5 +56,5 @@ void gvzwr_out(void)
 	one.addr = &buff[0];
 	one.len = 1;
 	zshow_output(zwr_output,&one);
-	mval_write(zwr_output,&val,TRUE);
+	mval_write(zwr_output,val,TRUE);
 }
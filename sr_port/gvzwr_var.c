@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2021 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2020-2023 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2020-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -31,16 +31,53 @@
 #include "gtm_string.h"
 #include "gtmimagename.h"
 #include "numcmp.h"
+#include "gvcst_protos.h"	/* for gvcst_queryget prototype */
 
 GBLREF bool		undef_inhibit;
 GBLREF gd_addr		*gd_header;
 GBLREF gd_region	*gv_cur_region;
-GBLREF gv_key		*gv_currkey;
+GBLREF gv_key		*gv_currkey, *gv_altkey;
+GBLREF gv_namehead	*gv_target;
 GBLREF gvzwrite_datablk *gvzwrite_block;
 GBLREF volatile int4   outofband;
 
 LITREF mval		literal_null;
 
+STATICFNDCL void gvzwr_var_query(uint4 data);
+
+/* ZWRITE of an entire global. Walk the nodes in $QUERY order with "gvcst_queryget" which finds the next node and
+ * returns its value in one database search instead of the $ORDER, $DATA and $GET searches per node that "gvzwr_var"
+ * does. The caller makes sure this order is the same as the one "gvzwr_var" would produce.
+ */
+STATICFNDEF void gvzwr_var_query(uint4 data)
+{
+	mval		val;
+	unsigned short	end, prev;
+
+	if ((1 == data) || (11 == data))
+		gvzwr_out();
+	if (1 >= data)
+		return;
+	end = gv_currkey->end;
+	prev = gv_currkey->prev;
+	for ( ; ; )
+	{
+		if (outofband)
+			async_action(FALSE);
+		GVKEY_INCREMENT_QUERY(gv_currkey);
+		if ((0 == gv_target->root) || !gvcst_queryget(&val))	/* global does not exist if root is 0 */
+			break;
+		/* Stop once past the last node of this global */
+		if ((gv_altkey->end <= end) || memcmp(gv_altkey->base, gv_currkey->base, end))
+			break;
+		COPY_KEY(gv_currkey, gv_altkey);
+		gvzwr_out_val(&val);
+	}
+	gv_currkey->end = end;
+	gv_currkey->prev = prev;
+	gv_currkey->base[end] = 0;
+}
+
 void gvzwr_var(uint4 data, int4 n)
 {
 	mval		mv, subdata;
@@ -57,6 +94,19 @@ void gvzwr_var(uint4 data, int4 n)
 	if (outofband)
 		async_action(FALSE);
 	zwr_sub = (zwr_sub_lst *)gvzwrite_block->sub;
+	/* The whole global is asked for when there is no subscript list (a name pattern) or it is just "*" (which is what
+	 * "m_zwrite" generates for an unsubscripted name too). $QUERY puts a null subscript where it collates but "gvzwr_var"
+	 * writes it last when standard null collation is not in effect so only take the $QUERY path when the two orders agree.
+	 */
+	if ((0 == n) && ((0 == gvzwrite_block->subsc_count)
+			|| ((1 == gvzwrite_block->subsc_count) && (ZWRITE_ASTERISK == zwr_sub->subsc_list[0].subsc_type)))
+		&& (NULL == TREF(gd_targ_gvnh_reg))
+		&& ((dba_bg == REG_ACC_METH(gv_cur_region)) || (dba_mm == REG_ACC_METH(gv_cur_region)))
+		&& (gv_cur_region->std_null_coll || (NEVER == gv_cur_region->null_subs)))
+	{
+		gvzwr_var_query(data);
+		return;
+	}
 	if ((0 == gvzwrite_block->subsc_count) && (0 == n))
 		zwr_sub->subsc_list[n].subsc_type = ZWRITE_ASTERISK;
 	if ((1 == data || 11 == data) &&
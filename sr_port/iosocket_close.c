@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2023 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2025 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -36,6 +36,7 @@
 #include "io.h"
 #include "gt_timer.h"
 #include "iosocketdef.h"
+#include "iosocket_epoll.h"
 #include "stringpool.h"
 #include "eintr_wrappers.h"
 #ifdef GTM_TLS
@@ -231,6 +232,7 @@ void iosocket_close_range(d_socket_struct *dsocketptr, int start, int end, boole
 				}
 #				endif
 			}
+			IOSOCKET_EPOLL_UNREGISTER(dsocketptr, socketptr);
 			CLOSE(socketptr->sd, rc);
 			if (-1 == rc)
 			{
@@ -256,6 +258,8 @@ void iosocket_close_range(d_socket_struct *dsocketptr, int start, int end, boole
 		for (jj = ii + 1; jj <= (dsocketptr->n_socket - 1); jj++)
 			dsocketptr->socket[jj - 1] = dsocketptr->socket[jj];
 		dsocketptr->n_socket--;
+		if (0 == dsocketptr->n_socket)
+			iosocket_epoll_close(dsocketptr);
 		ENABLE_INTERRUPTS(INTRPT_IN_SOCKET_CLOSE, prev_intrpt_state);
 	}
 	if (0 != save_rc)
@@ -3,7 +3,7 @@
  * Copyright (c) 2012-2022 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -21,6 +21,7 @@
 
 #include "io.h"
 #include "iosocketdef.h"
+#include "iosocket_epoll.h"
 #include "gtmio.h"
 
 GBLREF	io_log_name	*io_root_log_name;
@@ -69,6 +70,9 @@ void iosocket_destroy (io_desc *ciod)
 		ciod->dollar.devicebuffer = NULL;
 	}
 	if (dsocketptr)
+	{
+		iosocket_epoll_close(dsocketptr);
 		free(dsocketptr);
+	}
 	free(ciod);
 }
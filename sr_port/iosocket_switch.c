@@ -2,7 +2,7 @@
  *								*
  * Copyright 2001, 2013 Fidelity Information Services, Inc	*
  *								*
- * Copyright (c) 2018-2019 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -24,6 +24,7 @@
 #include "io_params.h"
 #include "gt_timer.h"
 #include "iosocketdef.h"
+#include "iosocket_epoll.h"
 
 GBLREF  uint4	ydb_max_sockets;
 
@@ -57,6 +58,7 @@ boolean_t iosocket_switch(char *handle, int handle_len, d_socket_struct *from, d
                         return FALSE;
                 }
 		socketptr = from->socket[index];
+		IOSOCKET_EPOLL_UNREGISTER(from, socketptr);	/* "to" registers it on its next WAIT */
 		socketptr->dev = to;
 		to->socket[to->n_socket++] = socketptr;
 		to->current_socket = to->n_socket - 1;
@@ -72,6 +74,8 @@ boolean_t iosocket_switch(char *handle, int handle_len, d_socket_struct *from, d
 		}
 		from->n_socket--;
 		from->socket[from->n_socket] = NULL;
+		if (0 == from->n_socket)
+			iosocket_epoll_close(from);
 	}
 	return TRUE;
 }
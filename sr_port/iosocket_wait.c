@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2023 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2025 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -42,6 +42,7 @@
 #include "io.h"
 #include "iotimer.h"
 #include "iosocketdef.h"
+#include "iosocket_epoll.h"
 #include "min_max.h"
 #include "deferred_events_queue.h"
 #include "stack_frame.h"
@@ -77,12 +78,15 @@ boolean_t iosocket_wait(io_desc *iod, uint8 nsec_timeout, mval *whatop, mval *ha
 	socket_struct		**poll_socketptr;	/* matching poll_fds */
 	size_t			poll_fds_size;
 	int			poll_timeout;
+	struct epoll_event	*epoll_events;		/* used instead of poll_fds[] to wait if use_epoll */
+	uint4			epoll_mask;
+	boolean_t		use_epoll;
 	d_socket_struct 	*dsocketptr;
 	socket_struct   	*socketptr, *which_socketptr = NULL, *prev_socketptr;;
 	socket_interrupt	*sockintr;
 	char            	*errptr, *charptr;
 	int4            	errlen, ii, jj, handle_index;
-	int4			npoll, rlisten, rconnected, rwrite;
+	int4			npoll, nidle, rlisten, rconnected, rwrite;
 	int4			oldestconnectedcycle, oldestconnectedindex;
 	int4			oldestwritecycle, oldestwriteindex;
 	int4			oldestlistencycle, oldestlistenindex;
@@ -175,7 +179,9 @@ boolean_t iosocket_wait(io_desc *iod, uint8 nsec_timeout, mval *whatop, mval *ha
 		sockintr->who_saved = sockwhich_invalid;
 	}
 	/* check for events */
-	poll_fds_size = dsocketptr->n_socket * (SIZEOF(struct pollfd) + SIZEOF(socket_struct *));
+	use_epoll = IOSOCKET_USE_EPOLL(dsocketptr, which_socketptr);
+	poll_fds_size = dsocketptr->n_socket * (SIZEOF(struct pollfd) + SIZEOF(socket_struct *)
+						+ (use_epoll ? SIZEOF(struct epoll_event) : 0));
 	if (NULL == TREF(poll_fds_buffer))
 	{
 		TREF(poll_fds_buffer) = malloc(poll_fds_size);
@@ -188,12 +194,13 @@ boolean_t iosocket_wait(io_desc *iod, uint8 nsec_timeout, mval *whatop, mval *ha
 	}
 	poll_fds = (struct pollfd *) TREF(poll_fds_buffer);
 	poll_socketptr = (socket_struct **)((char *)poll_fds + (dsocketptr->n_socket * SIZEOF(struct pollfd)));
+	epoll_events = (struct epoll_event *)((char *)poll_socketptr + (dsocketptr->n_socket * SIZEOF(socket_struct *)));
 	DBGSOCKWAIT((stdout,"waitcycle= %d\n",dsocketptr->waitcycle));
 	while (TRUE)
 	{
 		DBGSOCKWAIT((stdout,"wait loop:\n"));
 		poll_nfds = 0;
-		npoll = rlisten = rconnected = rwrite = 0;
+		npoll = nidle = rlisten = rconnected = rwrite = 0;
 		for (ii = 0; ii < dsocketptr->n_socket; ii++)
 		{
 			if (which_socketptr)
@@ -219,16 +226,37 @@ boolean_t iosocket_wait(io_desc *iod, uint8 nsec_timeout, mval *whatop, mval *ha
 						socketptr->readyforwhat |= SOCKREADY_READ;
 						rconnected++;
 						if (!socketptr->nonblocked_output)
+						{
+							if (use_epoll)
+								IOSOCKET_EPOLL_UNREGISTER(dsocketptr, socketptr);
 							continue;	/* no need to check if writable */
+						}
 					}
 				} else if (WAIT_FOR_READ & wait_for_what)
 				{
 					if (SOCKPEND_READ & socketptr->pendingevent)
 					{
 						rlisten++;
+						if (use_epoll)
+							IOSOCKET_EPOLL_UNREGISTER(dsocketptr, socketptr);
 						continue;	/* ready for ACCEPT now */
 					}
 				}
+				if (use_epoll)
+				{	/* registration persists across calls so this is usually a no-op */
+					epoll_mask = 0;
+					if (WAIT_FOR_READ & wait_for_what)
+						epoll_mask = EPOLLIN;
+					if ((socket_connected == socketptr->state) && socketptr->nonblocked_output
+						&& (WAIT_FOR_WRITE & wait_for_what))
+						epoll_mask |= EPOLLOUT;
+					iosocket_epoll_register(dsocketptr, socketptr, epoll_mask);
+					if (epoll_mask)
+						npoll++;
+					else
+						nidle++;	/* e.g. WRITE on blocking output; not in the epoll set */
+					continue;
+				}
 				poll_fds[poll_nfds].fd = socketptr->sd;
 				poll_fds[poll_nfds].events = 0;
 				if (WAIT_FOR_READ & wait_for_what)
@@ -243,7 +271,7 @@ boolean_t iosocket_wait(io_desc *iod, uint8 nsec_timeout, mval *whatop, mval *ha
 			if (which_socketptr)
 				break;		/* only check the one socket */
 		}
-		if (npoll)
+		if (npoll || nidle)
 		{
 			if (NO_M_TIMEOUT != nsec_timeout)
 			{
@@ -280,7 +308,16 @@ boolean_t iosocket_wait(io_desc *iod, uint8 nsec_timeout, mval *whatop, mval *ha
 				else
 					poll_timeout = (utimeout.tv_sec * MILLISECS_IN_SEC) +
 						DIVIDE_ROUND_UP(utimeout.tv_nsec, NANOSECS_IN_MSEC);
-				rv = poll(poll_fds, poll_nfds, poll_timeout);
+				if (use_epoll)
+				{	/* only ready sockets are returned; present them as if poll() had been used */
+					if (npoll)
+						rv = iosocket_epoll_wait(dsocketptr, epoll_events, npoll, poll_timeout,
+									poll_fds, poll_socketptr);
+					else	/* nothing registered; wait out the timeout as poll() would with no events */
+						rv = poll(NULL, 0, poll_timeout);
+					poll_nfds = MAX(rv, 0);
+				} else
+					rv = poll(poll_fds, poll_nfds, poll_timeout);
 				if (0 > rv && EINTR == errno)
 				{
 					eintr_handling_check();
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2023 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2022 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -291,6 +291,7 @@ MBSTART {													\
 		STRNDUP(SOCKPTR->remote.saddr_ip, SA_MAXLEN, NEWSOCKPTR->remote.saddr_ip);			\
 	if (NULL != SOCKPTR->parenthandle)									\
 		NEWSOCKPTR->parenthandle = NULL;									\
+	NEWSOCKPTR->epoll_events = 0;										\
 	iosocket_delimiter_copy(SOCKPTR, NEWSOCKPTR);								\
 }
 
@@ -458,6 +459,7 @@ typedef struct socket_struct_type
 	int				keepcnt;		/* TCP_KEEPCNT */
 	int				keepintvl;		/* TCP_KEEPINTVL */
 	int				iobfsize;		/* SO_SNDBUF */
+	uint4				epoll_events;		/* events registered in dev->epoll_fd, 0 if not registered */
 } socket_struct;
 
 typedef struct socket_interrupt_type
@@ -485,6 +487,9 @@ typedef struct d_socket_struct_type
 	gtm_chset_t			ichset_utf16_variant;		/* Save the UTF-16 variant (BE/LE) for reuse */
 	gtm_chset_t			ochset_utf16_variant;		/* Save the UTF-16 variant (BE/LE) for reuse */
 	struct io_desc_struct		*iod;				/* Point back to main IO descriptor block */
+	boolean_t			epoll_active;			/* epoll_fd is valid (see iosocket_epoll.h) */
+	int				epoll_fd;			/* epoll instance used by WAIT, kept across calls */
+	pid_t				epoll_pid;			/* process that created epoll_fd */
 	struct socket_struct_type 	*socket[1];			/* Array size determined by ydb_max_sockets */
 } d_socket_struct;
 
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2023 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2025 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -34,6 +34,7 @@
 #include "mdef.h"
 
 #include "gtm_string.h"
+#include "gtm_time.h"
 
 #include "cdb_sc.h"
 #include "gdsroot.h"
@@ -98,12 +99,17 @@ GBLREF	sgmnt_addrs		*kip_csa;
 GBLREF	boolean_t		need_kip_incr;
 GBLREF	uint4			update_trans;
 GBLREF	boolean_t		mu_reorg_in_swap_blk;
+GBLREF	uint4			mu_reorg_progress_secs;
 
 error_def(ERR_DBRDONLY);
 error_def(ERR_GBLNOEXIST);
 error_def(ERR_MAXBTLEVEL);
 error_def(ERR_MUREORGFAIL);
 
+/* Bounds of the extra sleep that MUPIP REORG -BACKOFF adds (on top of "reorg_sleep_nsec") between working blocks */
+#define	REORG_BACKOFF_MIN_NSEC		(100 * NANOSECS_IN_USEC)
+#define	REORG_BACKOFF_MAX_NSEC		(100 * NANOSECS_IN_MSEC)
+
 #define SAVE_REORG_RESTART													\
 {																\
 	cs_data->reorg_restart_block = dest_blk_id;										\
@@ -135,10 +141,29 @@ error_def(ERR_MUREORGFAIL);
 #endif
 
 void log_detailed_log(char *X, srch_hist *Y, srch_hist *Z, int level, kill_set *kill_set_list, trans_num tn);
+STATICFNDCL gtm_uint64_t reorg_contention(sgmnt_addrs *csa);
 void reorg_finish(block_id dest_blk_id, block_id blks_processed, block_id blks_killed,
 		block_id blks_reused, block_id file_extended, block_id lvls_reduced,
 		block_id blks_coalesced, block_id blks_split, block_id blks_swapped);
 
+/* Returns the number of grab crit failures seen by processes other than this one plus the number of transaction restarts
+ * seen by all processes in the region so far. MUPIP REORG -BACKOFF treats an increase in this between two working blocks
+ * as a sign that REORG is getting in the way of the application. Returns 0 if the region does not maintain statistics.
+ */
+STATICFNDEF gtm_uint64_t reorg_contention(sgmnt_addrs *csa)
+{
+	gvstats_rec_t	*all, *own;
+
+	if (RDBF_NOSTATS & csa->reservedDBFlags)
+		return 0;
+	all = &csa->nl->gvstats_rec;
+	own = csa->gvstats_rec_p;
+	return (all->n_crit_failed - own->n_crit_failed)
+		+ all->n_nontp_retries_0 + all->n_nontp_retries_1 + all->n_nontp_retries_2 + all->n_nontp_retries_3
+		+ all->n_tp_tot_retries_0 + all->n_tp_tot_retries_1 + all->n_tp_tot_retries_2 + all->n_tp_tot_retries_3
+		+ all->n_tp_tot_retries_4;
+}
+
 void log_detailed_log(char *X, srch_hist *Y, srch_hist *Z, int level, kill_set *kill_set_list, trans_num tn)
 {
 	int		i;
@@ -234,7 +259,10 @@ boolean_t mu_reorg(glist *gl_ptr, glist *exclude_glist_ptr, boolean_t *resume,
 	jnl_buffer_ptr_t	jbp;
 	trans_num		ret_tn;
 	mstr			*gn;
-	uint4			sleep_nsec;
+	uint4			sleep_nsec, backoff_nsec;
+	gtm_uint64_t		contention, prev_contention, blks_per_sec, progress_nsec, now_nsec;
+	block_id		progress_blks;
+	struct timespec		ts;
 #	ifdef UNIX
 	DEBUG_ONLY(unsigned int	lcl_t_tries;)
 #	endif
@@ -299,6 +327,11 @@ boolean_t mu_reorg(glist *gl_ptr, glist *exclude_glist_ptr, boolean_t *resume,
 	d_toler = (double) DATA_FILL_TOLERANCE * blk_size / 100.0;
 	i_toler = (double) INDEX_FILL_TOLERANCE * blk_size / 100.0;
 	blks_killed = blks_processed = blks_reused = lvls_reduced = blks_coalesced = blks_split = blks_swapped = 0;
+	backoff_nsec = 0;
+	prev_contention = reorg_contention(cs_addrs);
+	progress_blks = 0;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	progress_nsec = (ts.tv_sec * (gtm_uint64_t)NANOSECS_IN_SEC) + ts.tv_nsec;
 	pre_order_successor_level = level = MAX_BT_DEPTH + 1; /* Just some high value to initialize */
 
 	/* --- more detailed debugging information --- */
@@ -645,8 +678,37 @@ boolean_t mu_reorg(glist *gl_ptr, glist *exclude_glist_ptr, boolean_t *resume,
 		 */
 		sleep_nsec = cs_data->reorg_sleep_nsec;
 		assert((0 <= sleep_nsec) && (NANOSECS_IN_SEC > sleep_nsec));
+		if (reorg_op & BACKOFF)
+		{	/* Back off exponentially as long as other processes keep running into crit contention or restarts
+			 * and ease off the same way once they stop.
+			 */
+			contention = reorg_contention(cs_addrs);
+			if (contention != prev_contention)
+				backoff_nsec = MIN(MAX(2 * backoff_nsec, REORG_BACKOFF_MIN_NSEC), REORG_BACKOFF_MAX_NSEC);
+			else if (REORG_BACKOFF_MIN_NSEC > (backoff_nsec /= 2))
+				backoff_nsec = 0;
+			prev_contention = contention;
+			sleep_nsec = MIN(sleep_nsec + backoff_nsec, NANOSECS_IN_SEC - 1);
+		}
 		if (sleep_nsec)
 			NANOSLEEP(sleep_nsec, RESTART_TRUE, MT_SAFE_TRUE);
+		if (mu_reorg_progress_secs)
+		{	/* Use a monotonic clock with nanosecond resolution so a report covers the whole interval rather than
+			 * whatever is left of the current second of wall clock time.
+			 */
+			clock_gettime(CLOCK_MONOTONIC, &ts);
+			now_nsec = (ts.tv_sec * (gtm_uint64_t)NANOSECS_IN_SEC) + ts.tv_nsec;
+			if ((now_nsec - progress_nsec) >= (mu_reorg_progress_secs * (gtm_uint64_t)NANOSECS_IN_SEC))
+			{
+				blks_per_sec = ((blks_processed - progress_blks) * (gtm_uint64_t)NANOSECS_IN_SEC)
+						/ (now_nsec - progress_nsec);
+				util_out_print("Global: !AD (region !AD) : blocks processed !@UQ : blocks/second !@UQ : sleep !UL nsec",
+					FLUSH, gn->len, gn->addr, REG_LEN_STR(gv_cur_region), &blks_processed, &blks_per_sec,
+					sleep_nsec);
+				progress_blks = blks_processed;
+				progress_nsec = now_nsec;
+			}
+		}
 	}	/* ================ END MAIN LOOP ================ */
 
 	/* =========== START REDUCE LEVEL ============== */
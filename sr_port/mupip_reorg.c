@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2023 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2025 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -95,6 +95,7 @@ GBLREF	boolean_t		debug_mupip;
 GBLREF	boolean_t		jnlpool_init_needed;
 GBLREF	boolean_t		mu_reorg_more_tries;
 GBLREF	boolean_t		mu_reorg_process;
+GBLREF	uint4			mu_reorg_progress_secs;
 GBLREF	gd_region		*gv_cur_region;
 GBLREF	gv_key			*gv_currkey_next_reorg, *gv_currkey, *gv_altkey;
 GBLREF	gv_namehead		*reorg_gv_target;
@@ -120,7 +121,7 @@ void mupip_reorg(void)
 	unsigned short		n_len;
 	boolean_t		truncate, cur_success, restrict_reg, arg_present;
 	int			root_swap_statistic;
-	int4			truncate_percent;
+	int4			truncate_percent, progress_secs;
 	boolean_t		gotlock;
 	sgmnt_data_ptr_t	csd;
 	sgmnt_addrs		*csa;
@@ -246,6 +247,17 @@ void mupip_reorg(void)
 		reorg_op |= NOSPLIT;
 	if (CLI_PRESENT == cli_present("NOSWAP"))
 		reorg_op |= NOSWAP;
+	if (CLI_PRESENT == cli_present("BACKOFF"))
+		reorg_op |= BACKOFF;
+	if (CLI_PRESENT == cli_present("PROGRESS"))
+	{
+		if (!cli_get_int("PROGRESS", &progress_secs) || (0 >= progress_secs))
+		{
+			util_out_print("MUPIP REORG -PROGRESS requires a positive number of seconds.", FLUSH);
+			mupip_exit(ERR_MUPCLIERR);
+		}
+		mu_reorg_progress_secs = progress_secs;
+	}
 	if ((cli_status = cli_present("FILL_FACTOR")) == CLI_PRESENT)
 	{
 		assert(SIZEOF(data_fill_factor) == SIZEOF(int4));
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2023 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2023 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -611,6 +611,10 @@ typedef struct reg_ctl_list_struct
 	 */
 	boolean_t		process_losttn;	/* whether this region has started losttn processing */
 	trans_num		last_tn;	/* tn of last applied record in this region (to compare with next record's tn) */
+	gtm_uint64_t		forw_rec_cnt;	/* # of journal records processed in the forward phase for this region */
+	uint8			forw_start_nsec; /* CLOCK_MONOTONIC time (in nsec) when the current stretch of forward
+						  * processing of this region started */
+	uint8			forw_elapsed_nsec; /* total time (in nsec) spent on forward processing of this region */
 	struct reg_ctl_list_struct	*next_rctl;	/* Next region that has records to be processed (used only in mur_forward).
 							 * Initially, all journaled regions are in this circular linked list.
 							 * As soon as there are no more journal records in a region to be
@@ -1216,6 +1220,66 @@ typedef struct {
 	}															\
 }
 
+/* The forward phase moves between regions (in timestamp order once tp_resolve_time is reached) so the time taken by a region
+ * is the sum of the stretches of forward processing done on it. MUR_FORW_RATE_START and MUR_FORW_RATE_STOP bracket each such
+ * stretch so PRINT_VERBOSE_FORW_RATE can report the per-region (and with -PARALLEL, per-process) replay rate at the end of
+ * the forward phase. A multi-region TP transaction is charged to the region whose stretch plays it.
+ */
+#define MUR_FORW_RATE_START(RCTL)											\
+{															\
+	struct timespec		ts;											\
+															\
+	if (mur_options.verbose)											\
+	{														\
+		clock_gettime(CLOCK_MONOTONIC, &ts);									\
+		(RCTL)->forw_start_nsec = (ts.tv_sec * (uint8)NANOSECS_IN_SEC) + ts.tv_nsec;				\
+	}														\
+}
+
+#define MUR_FORW_RATE_STOP(RCTL)											\
+{															\
+	struct timespec		ts;											\
+	uint8			now_nsec;										\
+															\
+	if (mur_options.verbose)											\
+	{														\
+		clock_gettime(CLOCK_MONOTONIC, &ts);									\
+		now_nsec = (ts.tv_sec * (uint8)NANOSECS_IN_SEC) + ts.tv_nsec;						\
+		(RCTL)->forw_elapsed_nsec += (now_nsec - (RCTL)->forw_start_nsec);					\
+	}														\
+}
+
+#define PRINT_VERBOSE_FORW_RATE(RCTL)											\
+{															\
+	gtm_uint64_t		elapsed_usec, rate;									\
+	multi_proc_shm_hdr_t	*mp_hdr = NULL;	/* Pointer to "multi_proc_shm_hdr_t" structure in shared memory */	\
+															\
+	if (mur_options.verbose)											\
+	{														\
+		elapsed_usec = (RCTL)->forw_elapsed_nsec / 1000;							\
+		rate = elapsed_usec ? (((RCTL)->forw_rec_cnt * 1000000) / elapsed_usec) : (RCTL)->forw_rec_cnt;		\
+		if (multi_proc_in_use)											\
+		{													\
+			mp_hdr = multi_proc_shm_hdr;	/* Note: "mp_hdr" is usable only if "multi_proc_in_use" is TRUE */	\
+			if (!grab_latch(&mp_hdr->multi_proc_latch, MULTI_PROC_LATCH_TIMEOUT_SEC, NOT_APPLICABLE, NULL))	\
+			{												\
+				assert(FALSE);										\
+				rts_error_csa(CSA_ARG(NULL) VARLSTCNT(4)						\
+						ERR_MULTIPROCLATCH, 2, LEN_AND_LIT("PRINT_VERBOSE_FORW_RATE"));		\
+			}												\
+		}													\
+		gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_MUINFOUINT8, 4, LEN_AND_LIT("    Forward records processed"),	\
+			&(RCTL)->forw_rec_cnt, &(RCTL)->forw_rec_cnt);							\
+		gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_MUINFOUINT8, 4, LEN_AND_LIT("    Forward records/second"),	\
+			&rate, &rate);											\
+		if (multi_proc_in_use)											\
+		{													\
+			assert(mp_hdr);											\
+			rel_latch(&mp_hdr->multi_proc_latch);								\
+		}													\
+	}														\
+}
+
 #define PRINT_VERBOSE_TAIL_BAD(JCTL)										\
 {														\
 	if (mur_options.verbose)										\
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2023 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2019 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -365,6 +365,7 @@ int	mur_forward_multi_proc(reg_ctl_list *rctl)
 			gv_target = cs_addrs->dir_tree;
 		}
 		jctl->after_end_of_data = FALSE;
+		MUR_FORW_RATE_START(rctl);
 		status = mur_next(jctl, jctl->rec_offset);
 		assert(ERR_JNLREADEOF != status);	/* cannot get EOF at start of forward processing */
 		if (SS_NORMAL != status)
@@ -406,6 +407,7 @@ int	mur_forward_multi_proc(reg_ctl_list *rctl)
 				break;
 			status = mur_next_rec(&jctl);
 		} while (SS_NORMAL == status);
+		MUR_FORW_RATE_STOP(rctl);
 		CHECK_IF_EOF_REACHED(rctl, status); /* sets rctl->forw_eof_seen if needed; resets "status" to SS_NORMAL */
 		if (SS_NORMAL != status)
 		{	/* ERR_FILENOTCREATE and ERR_FILENAMETOOLONG/SYSTEN-E-ENAMETOOLONG are possible from "mur_cre_file_extfmt"
@@ -545,6 +547,7 @@ int	mur_forward_multi_proc(reg_ctl_list *rctl)
 		MUR_CHANGE_REG(rctl);
 		jctl = rctl->jctl;
 		this_reg_stuck = FALSE;
+		MUR_FORW_RATE_START(rctl);
 		for ( status = SS_NORMAL; SS_NORMAL == status; )
 		{
 			if (multi_proc && IS_FORCED_MULTI_PROC_EXIT(mp_hdr))
@@ -660,6 +663,7 @@ int	mur_forward_multi_proc(reg_ctl_list *rctl)
 			assert(!this_reg_stuck);
 			status = mur_next_rec(&jctl);
 		}
+		MUR_FORW_RATE_STOP(rctl);
 		assert((NULL == rctl->forw_multi) || this_reg_stuck);
 		assert((NULL != rctl->forw_multi) || !this_reg_stuck);
 		if (!this_reg_stuck)
@@ -715,6 +719,7 @@ int	mur_forward_multi_proc(reg_ctl_list *rctl)
 			MUR_SET_MULTI_PROC_KEY(rctl, multi_proc_key);
 		}
 		PRINT_VERBOSE_STAT(rctl->jctl, "mur_forward:at the end");
+		PRINT_VERBOSE_FORW_RATE(rctl);
 		assert(!mur_options.rollback || (0 != murgbl.consist_jnl_seqno));
 		assert(mur_options.rollback || (0 == murgbl.consist_jnl_seqno));
 		assert(!dollar_tlevel);	/* In case it applied a broken TUPD */
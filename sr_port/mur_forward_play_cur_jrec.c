@@ -3,7 +3,7 @@
  * Copyright (c) 2010-2023 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2018 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -113,6 +113,7 @@ uint4	mur_forward_play_cur_jrec(reg_ctl_list *rctl)
 		MUR_SET_MULTI_PROC_KEY(rctl, multi_proc_key);
 	}
 	jctl = rctl->jctl;
+	rctl->forw_rec_cnt++;
 	/* Ensure we never DOUBLE process the same journal record in the forward phase */
 	assert((jctl != rctl->last_processed_jctl) || (jctl->rec_offset != rctl->last_processed_rec_offset));
 #	ifdef DEBUG
@@ -3,6 +3,9 @@
  * Copyright (c) 2003-2015 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
  *	This source code contains the intellectual property	*
  *	of its copyright holder(s), and is made available	*
  *	under a license.  If you do not know the terms of	*
@@ -41,23 +44,41 @@
 
 #else /* !MUR_USE_AIO && !VMS */
 
+/* Without AIO, the read-ahead is split in two. MUR_FREAD_START only asks the kernel to start bringing the chunk into the
+ * file system cache (POSIX_FADV_WILLNEED returns without waiting for the I/O) and MUR_FREAD_WAIT does the actual read,
+ * which by then is mostly a copy from the cache. This lets the disk I/O for the next chunk overlap with the processing of
+ * the current chunk in both directions of travel. The kernel's own readahead only helps the forward direction, not the
+ * backward scan. The caller does not look at the buffer contents until MUR_FREAD_WAIT is done (same as with AIO) so
+ * deferring the read is safe. Any error from posix_fadvise() is ignored since it is only a hint; a real read error
+ * surfaces in MUR_FREAD_WAIT.
+ */
+#ifdef POSIX_FADV_WILLNEED
+#  define MUR_FREAD_ADVISE(CHANNEL, OFFSET, LEN)	(void)posix_fadvise(CHANNEL, OFFSET, LEN, POSIX_FADV_WILLNEED)
+#else
+#  define MUR_FREAD_ADVISE(CHANNEL, OFFSET, LEN)
+#endif
+
 /* #GTM_THREAD_SAFE : The below macro (MUR_FREAD_START) is thread-safe */
 #define MUR_FREAD_START(JCTL, BUFF_DESC, RET_STATUS)					\
 {											\
 	assert(JCTL->eof_addr > (BUFF_DESC)->dskaddr);					\
+	assert(!(BUFF_DESC)->read_in_progress);						\
 	(BUFF_DESC)->blen = MIN(MUR_BUFF_SIZE, JCTL->eof_addr - (BUFF_DESC)->dskaddr);	\
-	DO_FILE_READ(JCTL->channel, (BUFF_DESC)->dskaddr, (BUFF_DESC)->base, 		\
-			(BUFF_DESC)->blen, JCTL->status, JCTL->status2);		\
+	(BUFF_DESC)->rip_channel = JCTL->channel;					\
+	MUR_FREAD_ADVISE(JCTL->channel, (BUFF_DESC)->dskaddr, (BUFF_DESC)->blen);	\
 	(BUFF_DESC)->read_in_progress = TRUE;						\
-	RET_STATUS = JCTL->status;							\
+	RET_STATUS = SS_NORMAL;								\
 }
 
 /* #GTM_THREAD_SAFE : The below macro (MUR_FREAD_WAIT) is thread-safe */
-#define MUR_FREAD_WAIT(JCTL, BUFF_DESC, RET_STATUS)				\
-{										\
-	assert((BUFF_DESC)->read_in_progress);					\
-	(BUFF_DESC)->read_in_progress = FALSE;					\
-	RET_STATUS = SS_NORMAL;							\
+#define MUR_FREAD_WAIT(JCTL, BUFF_DESC, RET_STATUS)					\
+{											\
+	assert((BUFF_DESC)->read_in_progress);						\
+	assert((BUFF_DESC)->rip_channel == JCTL->channel);				\
+	(BUFF_DESC)->read_in_progress = FALSE;						\
+	DO_FILE_READ((BUFF_DESC)->rip_channel, (BUFF_DESC)->dskaddr, (BUFF_DESC)->base,	\
+			(BUFF_DESC)->blen, JCTL->status, JCTL->status2);		\
+	RET_STATUS = JCTL->status;							\
 }
 
 /* #GTM_THREAD_SAFE : The below macro (MUR_FREAD_CANCEL) is thread-safe */
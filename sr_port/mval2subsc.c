@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2016 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2020 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -15,6 +15,8 @@
 
 #include "mdef.h"
 
+#include "gtm_string.h"
+
 #include "arit.h"
 #include "gdsroot.h"
 #include "gtm_facility.h"
@@ -29,6 +31,13 @@
 
 GBLREF	gv_namehead	*gv_target;
 
+/* Non-zero if any byte of the 8-byte word W is 0x00 or 0x01, i.e. needs a STR_SUB_ESCAPE in a string subscript.
+ * Clearing the low bit of every byte turns both of those into 0x00 which the usual "has a zero byte" test then finds.
+ */
+#define	STR_SUB_NEEDS_ESCAPE(W)								\
+	((((W) & 0xFEFEFEFEFEFEFEFEULL) - 0x0101010101010101ULL)			\
+		& ~((W) & 0xFEFEFEFEFEFEFEFEULL) & 0x8080808080808080ULL)
+
 static readonly unsigned char pos_code[100] =
 {
 	0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a,
@@ -67,6 +76,7 @@ unsigned char *mval2subsc(mval *in_val, gv_key *out_key, boolean_t std_null_coll
 	uint4		mvt;	/* Local copy of mvtype, bit ands use a int4, so do conversion once */
 	unsigned int	digs, exp_val;
 	int		tmp_len, avail_bytes;
+	gtm_uint64_t	word;
 	DCL_THREADGBL_ACCESS;
 
 	SETUP_THREADGBL_ACCESS;
@@ -134,7 +144,18 @@ unsigned char *mval2subsc(mval *in_val, gv_key *out_key, boolean_t std_null_coll
 		{
 			*out_ptr++ = STR_SUB_PREFIX;
 			do
-			{
+			{	/* Copy 8 bytes at a time as long as none of them needs to be escaped */
+				for ( ; SIZEOF(word) <= tmp_len; tmp_len -= SIZEOF(word))
+				{
+					memcpy(&word, in_ptr, SIZEOF(word));
+					if (STR_SUB_NEEDS_ESCAPE(word))
+						break;
+					memcpy(out_ptr, &word, SIZEOF(word));
+					in_ptr += SIZEOF(word);
+					out_ptr += SIZEOF(word);
+				}
+				if (0 == tmp_len)
+					break;
 				ch = *in_ptr++;
 				if (ch <= 1)
 				{
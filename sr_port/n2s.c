@@ -3,6 +3,9 @@
  * Copyright (c) 2001-2018 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
  *	This source code contains the intellectual property	*
  *	of its copyright holder(s), and is made available	*
  *	under a license.  If you do not know the terms of	*
@@ -21,6 +24,12 @@
 
 GBLREF spdesc	stringpool;
 
+/* Two characters for each of 00 thru 99 so the integer part of an MV_INT value is emitted two digits per division */
+static readonly char digit_pairs[] =
+	"00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+	"40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+	"8081828384858687888990919293949596979899";
+
 unsigned char *n2s(mval *mv_ptr)
 {
 	unsigned char	*start, *cp, *cp1;
@@ -66,12 +75,14 @@ unsigned char *n2s(mval *mv_ptr)
 			}
 			*--cp1 = '.';
 		}
-		while (m0 > 0)
+		for ( ; 10 <= m0; m0 /= 100)
 		{
-			tmp = m0;
-			m0 /= 10;
-			*--cp1 = tmp - (m0 * 10) + '0';
+			tmp = (m0 % 100) * 2;
+			*--cp1 = digit_pairs[tmp + 1];
+			*--cp1 = digit_pairs[tmp];
 		}
+		if (m0 > 0)
+			*--cp1 = m0 + '0';
 		n0 = (int4)(ARRAYTOP(lcl_buf) - cp1);
 		memcpy(cp, cp1, n0);
 		cp += n0;
@@ -2,7 +2,7 @@
  *								*
  *	Copyright 2001, 2007 Fidelity Information Services, Inc	*
  *								*
- * Copyright (c) 2024 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2024-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -16,6 +16,7 @@
 #define NUMCMP_INCLUDED
 
 #include "promodemo.h"
+#include "arit.h"
 
 long numcmp(mval *u, mval *v);
 
@@ -44,6 +45,22 @@ long numcmp(mval *u, mval *v);
 			else /* (u_m1  < v_m1) */  ret = -1;							\
 			break;											\
 		}												\
+		/* If one is an integer and the other a non-integer representation with an exponent too		\
+		 * large for an integer (magnitude >= 1E6, e.g. the terminator of "FOR I=1:1:1E6"), the		\
+		 * sign of the latter decides. "op_forloop" does this comparison on every iteration.		\
+		 */												\
+		if (u_mvtype)											\
+		{												\
+			if (!(v->mvtype & MV_INT) && (EXP_INT_OVERF <= v->e))					\
+			{											\
+				ret = (0 == v->sgn) ? -1 : 1;							\
+				break;										\
+			}											\
+		} else if ((v->mvtype & MV_INT) && (EXP_INT_OVERF <= u->e))					\
+		{												\
+			ret = (0 == u->sgn) ? 1 : -1;								\
+			break;											\
+		}												\
 		/* If not both integer, promote either one that might be. */					\
 		if (u_mvtype)											\
 		{												\
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2022 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2020-2024 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2020-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -239,16 +239,20 @@ void op_add (mval *u, mval *v, mval *s)
 	int4    m0, m1;
 	char	utype, vtype;
 
-	/* If u or v is $ZYSQLNULL, the result is $ZYSQLNULL */
-	if (MV_IS_SQLNULL(u) || MV_IS_SQLNULL(v))
-	{
-		MV_FORCE_DEFINED(u);
-		MV_FORCE_DEFINED(v);
-		*s = literal_sqlnull;
-		return;
+	if (!(u->mvtype & v->mvtype & MV_INT))
+	{	/* An mval with MV_INT set is defined, numeric and not $ZYSQLNULL so two integer operands (e.g. "SET X=X+1"
+		 * in a loop) skip these checks. If u or v is $ZYSQLNULL, the result is $ZYSQLNULL.
+		 */
+		if (MV_IS_SQLNULL(u) || MV_IS_SQLNULL(v))
+		{
+			MV_FORCE_DEFINED(u);
+			MV_FORCE_DEFINED(v);
+			*s = literal_sqlnull;
+			return;
+		}
+		MV_FORCE_NUM(u);
+		MV_FORCE_NUM(v);
 	}
-	MV_FORCE_NUM(u);
-	MV_FORCE_NUM(v);
 	utype = u->mvtype;
 	vtype = v->mvtype;
 	if ( utype & vtype & MV_INT )
@@ -284,16 +288,20 @@ void op_sub (mval *u, mval *v, mval *s)
 	int4    m0, m1;
 	char	utype, vtype;
 
-	/* If u or v is $ZYSQLNULL, the result is $ZYSQLNULL */
-	if (MV_IS_SQLNULL(u) || MV_IS_SQLNULL(v))
-	{
-		MV_FORCE_DEFINED(u);
-		MV_FORCE_DEFINED(v);
-		*s = literal_sqlnull;
-		return;
+	if (!(u->mvtype & v->mvtype & MV_INT))
+	{	/* An mval with MV_INT set is defined, numeric and not $ZYSQLNULL so two integer operands (e.g. "SET X=X-1"
+		 * in a loop) skip these checks. If u or v is $ZYSQLNULL, the result is $ZYSQLNULL.
+		 */
+		if (MV_IS_SQLNULL(u) || MV_IS_SQLNULL(v))
+		{
+			MV_FORCE_DEFINED(u);
+			MV_FORCE_DEFINED(v);
+			*s = literal_sqlnull;
+			return;
+		}
+		MV_FORCE_NUM(u);
+		MV_FORCE_NUM(v);
 	}
-	MV_FORCE_NUM(u);
-	MV_FORCE_NUM(v);
 	utype = u->mvtype;
 	vtype = v->mvtype;
 	if ( utype & vtype & MV_INT )
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2020 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -58,13 +58,21 @@ STATICFNDCL void op_gvname_common(int count, int hash_code, mval *val_arg, va_li
 void op_gvname(UNIX_ONLY_COMMA(int count_arg) mval *val_arg, ...)
 {
 	int	 	hash_code;
+	gvnh_reg_t	*gvnh_reg;
 	mval		tmpval;
 	va_list		var;
 	VMS_ONLY(int	count;)
 
 	tmpval = *val_arg;
 	tmpval.str.len = MIN(tmpval.str.len, MAX_MIDENT_LEN);
-	COMPUTE_HASH_MSTR(tmpval.str, hash_code);
+	/* If this is the same global name as the last one bound in the current gld, reuse its hash code */
+	gvnh_reg = NULL;
+	if (NULL != gd_header)
+		GD_LAST_GVNH_REG(gd_header, tmpval.str, gvnh_reg);
+	if (NULL != gvnh_reg)
+		hash_code = gvnh_reg->gvt->gvname.hash_code;
+	else
+		COMPUTE_HASH_MSTR(tmpval.str, hash_code);
 	VAR_START(var, val_arg);
 	VMS_ONLY(va_count(count);)
 	op_gvname_common(UNIX_ONLY_COMMA(count_arg+1) VMS_ONLY_COMMA(count+1) hash_code, &tmpval, var);
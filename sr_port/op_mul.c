@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2023 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2025 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -34,16 +34,20 @@ void	op_mul(mval *u, mval *v, mval *p)
 	DCL_THREADGBL_ACCESS;
 
 	SETUP_THREADGBL_ACCESS;
-	/* If u or v is $ZYSQLNULL, the result is $ZYSQLNULL */
-	if (MV_IS_SQLNULL(u) || MV_IS_SQLNULL(v))
-	{
-		MV_FORCE_DEFINED(u);
-		MV_FORCE_DEFINED(v);
-		*p = literal_sqlnull;
-		return;
+	if (!(u->mvtype & v->mvtype & MV_INT))
+	{	/* An mval with MV_INT set is defined, numeric and not $ZYSQLNULL so two integer operands skip these checks.
+		 * If u or v is $ZYSQLNULL, the result is $ZYSQLNULL.
+		 */
+		if (MV_IS_SQLNULL(u) || MV_IS_SQLNULL(v))
+		{
+			MV_FORCE_DEFINED(u);
+			MV_FORCE_DEFINED(v);
+			*p = literal_sqlnull;
+			return;
+		}
+		MV_FORCE_NUM(u);
+		MV_FORCE_NUM(v);
 	}
-	MV_FORCE_NUM(u);
-	MV_FORCE_NUM(v);
 	u_mvtype = u->mvtype;
 	v_mvtype = v->mvtype;
 	if (u_mvtype & MV_INT & v_mvtype)
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2023 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2025 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -27,6 +27,7 @@ GBLREF unsigned int	t_tries;
 
 #define DIGIT(x)	((x >='0') && (x <= '9'))
 #define NUM_MASK	(MV_NM | MV_INT | MV_NUM_APPROX)
+#define MAX_MVINT_DIGITS	6	/* integers with at most this many digits fit in the MV_INT form (see MANT_HI/MV_BIAS) */
 
 error_def(ERR_NUMOFLOW);
 
@@ -56,6 +57,24 @@ char *s2n(mval *u)
 		return c;
 	}
 	eos = u->str.addr + u->str.len;				/* End of string marker */
+	/* Fast path for the most common input, a canonic integer (an optional "-" followed by at most MAX_MVINT_DIGITS digits
+	 * with no leading zero, or just "0") that is stored in the MV_INT form. Anything else is left to the general parse below.
+	 */
+	d = c + (('-' == *c) ? 1 : 0);
+	if (((eos - d) <= MAX_MVINT_DIGITS) && (d < eos)
+		&& ((('1' <= *d) && ('9' >= *d)) || (('0' == *d) && (1 == u->str.len))))
+	{
+		for (x = 0, w = d; (w < eos) && DIGIT(*w); w++)
+			x = (x * 10) + (*w - '0');
+		if (w == eos)
+		{
+			u->m[0] = 0;
+			u->m[1] = ((d != c) ? -x : x) * MV_BIAS;
+			u->mvtype |= (MV_NM | MV_INT);
+			TREF(s2n_intlit) = (d != c);
+			return eos;
+		}
+	}
 	sign = 0;
 	while (c < eos && (('-'== *c) || ('+' == *c)))
 		sign += (('-' == *c++) ? 1 : 2);		/* Sign is odd: negative, even: positive */
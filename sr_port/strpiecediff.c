@@ -3,6 +3,9 @@
  * Copyright (c) 2010-2023 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
  *	This source code contains the intellectual property	*
  *	of its copyright holder(s), and is made available	*
  *	under a license.  If you do not know the terms of	*
@@ -219,3 +222,56 @@ void	strpiecediff(mstr *oldstr, mstr *newstr, mstr *delim,
 	assert(',' != *pcdiff_start);
 	return;
 }
+
+/* Returns a superset of the pieces that differ between oldstr and newstr (see STRPIECEMASK_BIT) using the same notion of
+ * "differ" as strpiecediff() (a piece present in only one of the strings differs even if it is empty). This is cheap enough
+ * to compute once per update and lets callers skip strpiecediff() when no piece of interest could have changed. Only a
+ * single byte delimiter (that cannot be part of a multi-byte character if use_matchc is TRUE) is handled; for any other
+ * delimiter STRPIECEMASK_ALL is returned.
+ */
+uint8	strpiecemask(mstr *oldstr, mstr *newstr, mstr *delim, boolean_t use_matchc)
+{
+	uint8		mask;
+	uint4		curpiece;
+	char		delimch, *old_ptr, *old_top, *old_end, *new_ptr, *new_top, *new_end;
+	boolean_t	old_piece_exists, new_piece_exists;
+
+	if ((1 != delim->len) || (use_matchc && (0x80 <= *(unsigned char *)delim->addr)))
+		return STRPIECEMASK_ALL;
+	if ((oldstr->len == newstr->len) && (0 == memcmp(oldstr->addr, newstr->addr, oldstr->len)))
+		return 0;
+	delimch = *delim->addr;
+	old_ptr = oldstr->addr;
+	old_top = old_ptr + oldstr->len;
+	new_ptr = newstr->addr;
+	new_top = new_ptr + newstr->len;
+	old_end = new_end = NULL;
+	old_piece_exists = new_piece_exists = TRUE;	/* piece 1 exists even in an empty string */
+	mask = 0;
+	for (curpiece = 1; old_piece_exists || new_piece_exists; curpiece++)
+	{
+		if (old_piece_exists && (NULL == (old_end = memchr(old_ptr, delimch, old_top - old_ptr))))
+			old_end = old_top;
+		if (new_piece_exists && (NULL == (new_end = memchr(new_ptr, delimch, new_top - new_ptr))))
+			new_end = new_top;
+		if ((old_piece_exists != new_piece_exists) || ((old_end - old_ptr) != (new_end - new_ptr))
+				|| (0 != memcmp(old_ptr, new_ptr, old_end - old_ptr)))
+		{
+			mask |= STRPIECEMASK_BIT(curpiece);
+			if (64 <= curpiece)
+				break;	/* all remaining pieces map to the same bit */
+		}
+		/* A piece after the current one exists only if the current one ended with a delimiter */
+		if (old_piece_exists)
+		{
+			old_piece_exists = (old_end < old_top);
+			old_ptr = old_end + 1;
+		}
+		if (new_piece_exists)
+		{
+			new_piece_exists = (new_end < new_top);
+			new_ptr = new_end + 1;
+		}
+	}
+	return mask;
+}
@@ -2,6 +2,9 @@
  *								*
  *	Copyright 2010 Fidelity Information Services, Inc	*
  *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
  *	This source code contains the intellectual property	*
  *	of its copyright holder(s), and is made available	*
  *	under a license.  If you do not know the terms of	*
@@ -12,7 +15,12 @@
 #ifndef STRPIECEDIFF_INCLUDED
 #define STRPIECEDIFF_INCLUDED
 
+/* strpiecemask() summarizes the changed pieces as a bitmask: bit N-1 for piece N (N < 64) and bit 63 for all pieces >= 64 */
+#define	STRPIECEMASK_ALL	((uint8)-1)
+#define	STRPIECEMASK_BIT(PIECE)	((uint8)1 << (((64 <= (PIECE)) ? 64 : (PIECE)) - 1))
+
 void	strpiecediff(mstr *oldstr, mstr *newstr, mstr *delim,
 			uint4 numpieces, gtm_num_range_t *piecearray, boolean_t use_matchc, mstr *pcdiff_mstr);
+uint8	strpiecemask(mstr *oldstr, mstr *newstr, mstr *delim, boolean_t use_matchc);
 
 #endif
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2023 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2025 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -249,6 +249,8 @@ trans_num t_end(srch_hist *hist1, srch_hist *hist2, trans_num ctn)
 	boolean_t		before_image_needed, lcl_ss_in_prog = FALSE, reorg_ss_in_prog = FALSE;
 	boolean_t		ss_need_to_restart, new_bkup_started;
 	boolean_t		same_db_state;
+	uint8			crit_grab_nsec;
+	struct timespec		ts;
 	gv_namehead		*gvnh;
 	gd_region		*reg;
 #	ifdef GTM_TRIGGER
@@ -289,6 +291,7 @@ trans_num t_end(srch_hist *hist1, srch_hist *hist2, trans_num ctn)
 	DEBUG_ONLY(in_mu_truncate = (cnl != NULL && process_id == cnl->trunc_pid);)
 	TREF(rlbk_during_redo_root) = FALSE;
 	status = cdb_sc_normal;
+	crit_grab_nsec = 0;	/* set below once crit is grabbed for the commit; the "failed_skip_revert" code checks it */
 	/* The only cases where we set csa->hold_onto_crit to TRUE are the following :
 	 * (a) jgbl.onlnrlbk
 	 * (b) DSE CRIT -SEIZE (and any command that follows it), DSE CHANGE -BLOCK, DSE ALL -SEIZE (and any command that follows)
@@ -672,6 +675,36 @@ trans_num t_end(srch_hist *hist1, srch_hist *hist2, trans_num ctn)
 	assert(!csa->hold_onto_crit || csa->now_crit);
 	if (!csa->now_crit)
 	{
+		if (!is_mm)
+		{	/* Before grabbing crit, look for a history block whose cache record still holds it and that has been
+			 * modified since it was read. The validation in crit below is certain to fail on such a block, so
+			 * restart now rather than make every other updater of this region wait for us to find that out.
+			 * Leaf blocks that the $INCREMENT or NOISOLATION recompute logic below might still commit are left
+			 * to that logic. The pass also brings the history buffers into the CPU cache ahead of crit.
+			 */
+			for EACH_HIST(hist, hist1, hist2)
+			{
+				for (t1 = hist->h;  t1->blk_num;  t1++)
+				{
+					cr = db_csh_get(t1->blk_num);
+					if ((NULL == cr) || ((cache_rec_ptr_t)CR_NOTVALID == cr) || (cr->cycle != t1->cycle)
+							|| (cr->blk != t1->blk_num)
+							|| ((sm_long_t)GDS_REL2ABS(cr->buffaddr) != (sm_long_t)t1->buffaddr))
+						continue;
+					if (t1->tn > ((blk_hdr_ptr_t)t1->buffaddr)->tn)
+						continue;
+					if (!t1->level && (1 == cw_set_depth) && (t1->blk_num == cw_set[0].blk)
+						&& (IS_DOLLAR_INCREMENT || (t1->blk_target
+							&& t1->blk_target->noisolation && cw_set[0].recompute_list_head)))
+						continue;
+					assert(CDB_STAGNATE > t_tries);
+					status = cdb_sc_blkmod;
+					NONTP_TRACE_HIST_MOD(t1, t_blkmod_t_end_precrit);
+					INCR_GVSTATS_COUNTER(csa, cnl, n_nontp_precrit_restarts, 1);
+					goto failed;
+				}
+			}
+		}
 		/* Get more space if needed. This is done outside crit so that any necessary IO has a chance of occurring
 		 * outside crit. The available space must be double-checked inside crit.
 		 */
@@ -693,6 +726,8 @@ trans_num t_end(srch_hist *hist1, srch_hist *hist2, trans_num ctn)
 			if (!FROZEN_HARD(csa))
 			{
 				assert(tmp_jnlpool == jnlpool);
+				clock_gettime(CLOCK_MONOTONIC, &ts);
+				crit_grab_nsec = ((uint8)ts.tv_sec * NANOSECS_IN_SEC) + ts.tv_nsec;
 				break;
 			}
 			rel_crit(reg);
@@ -1770,7 +1805,15 @@ trans_num t_end(srch_hist *hist1, srch_hist *hist2, trans_num ctn)
 		UNPIN_CACHE_RECORD(cr_array[0]);
 	}
 	if (!csa->hold_onto_crit)
+	{
 		rel_crit(reg);	/* Step CMT14 */
+		if (crit_grab_nsec)
+		{
+			clock_gettime(CLOCK_MONOTONIC, &ts);
+			INCR_GVSTATS_COUNTER(csa, cnl, n_nontp_crit_hold_nsec,
+				((uint8)ts.tv_sec * NANOSECS_IN_SEC) + ts.tv_nsec - crit_grab_nsec);
+		}
+	}
 	/* Now that all buffers needed for commit are locked in shared memory (in phase1 for BG), it is safe to
 	 * release the jnlpool lock. Releasing it before this could cause an instance freeze to sneak in while
 	 * the phase1 is still midway causing trouble for this transaction in case it needs to do any db/jnl writes.
@@ -1884,6 +1927,12 @@ failed_skip_revert:
 	RESTORE_CURRTN_IF_NEEDED(csa, cti, write_inctn, decremented_currtn);
 	retvalue = t_commit_cleanup(status, 0);	/* we expect to get a return value indicating update was NOT underway */
 	assert(!retvalue); 			/* if it was, then we would have done a "goto skip_cr_array:" instead */
+	if (crit_grab_nsec && !csa->now_crit)
+	{	/* Crit held by a commit attempt that restarts counts as much as that of one that commits */
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		INCR_GVSTATS_COUNTER(csa, cnl, n_nontp_crit_hold_nsec,
+			((uint8)ts.tv_sec * NANOSECS_IN_SEC) + ts.tv_nsec - crit_grab_nsec);
+	}
 	if ((NULL != hist1) && (NULL != (gvnh = hist1->h[0].blk_num ? hist1->h[0].blk_target : NULL)))
 		gvnh->clue.end = 0;
 	if ((NULL != hist2) && (NULL != (gvnh = hist2->h[0].blk_num ? hist2->h[0].blk_target : NULL)))
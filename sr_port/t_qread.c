@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2023 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2024 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -83,6 +83,7 @@ GBLREF	boolean_t		mupip_jnl_recover;
 GBLREF	uint4			mu_reorg_encrypt_in_prog;	/* non-zero if MUPIP REORG ENCRYPT is in progress */
 GBLREF	sgmnt_addrs		*reorg_encrypt_restart_csa;
 GBLREF	uint4			update_trans;
+GBLREF	boolean_t		low_priority_reads;
 
 /* There are 3 passes (of the do-while loop below) we allow now.
  * The first pass which is potentially out-of-crit and hence can end up not locating the cache-record for the input block.
@@ -295,7 +296,8 @@ sm_uc_ptr_t t_qread(block_id blk, sm_int_ptr_t cycle, cache_rec_ptr_ptr_t cr_out
 			{
 				*cycle = first_tp_srch_status->cycle;
 				*cr_out = cr;
-				cr->refer = TRUE;
+				if (!low_priority_reads)
+					cr->refer = TRUE;
 				if (CDB_STAGNATE <= t_tries)	/* mu_reorg doesn't use TP else should have an || for that */
 					CWS_INSERT(blk);
 				return (sm_uc_ptr_t)first_tp_srch_status->buffaddr;
@@ -551,6 +553,8 @@ sm_uc_ptr_t t_qread(block_id blk, sm_int_ptr_t cycle, cache_rec_ptr_ptr_t cr_out
 				assert(0 == cr->dirty);
 				/* Only set in cache if read was success */
 				cr->ondsk_blkver = ondsk_blkver;
+				if (low_priority_reads)
+					cr->refer = FALSE;	/* so "db_csh_getn" reuses this buffer before any referenced one */
 				cr->r_epid = 0;
 				RELEASE_BUFF_READ_LOCK(cr);
 				TREF(block_now_locked) = NULL;
@@ -3,6 +3,9 @@
  * Copyright (c) 2008-2023 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
  *	This source code contains the intellectual property	*
  *	of its copyright holder(s), and is made available	*
  *	under a license.  If you do not know the terms of	*
@@ -136,6 +139,11 @@ TAB_GVSTATS_REC(n_writer_flush       , "WFL",  "# of DB FLushes by the writer he
 TAB_GVSTATS_REC(n_writer_helper_epoch, "WHE",  "# of waits for jnl write lock or fsync")
 /* End stats for GTM-8863 (please do not delete this) */
 /* If new stats are added beyond this point, edit gvstats_rec_cnl2csd in gvstats_rec.c */
+TAB_GVSTATS_REC(n_tp_crit_hold_nsec  , "TCH",  "nanosecs crit held by Tp commit tries ")
+TAB_GVSTATS_REC(n_tp_precrit_restarts, "TPV",  "# of Tp restarts before commit crit   ")
+TAB_GVSTATS_REC(n_nontp_crit_hold_nsec, "NCH",  "nanosecs crit held by Non-tp cmt tries")
+TAB_GVSTATS_REC(n_nontp_precrit_restarts, "NPV",  "# Non-tp restarts before commit crit  ")
+TAB_GVSTATS_REC(n_db_extend_nsec     , "DXT",  "nanosecs spent in db file extensions  ")
 
 /*
  * At some point the stats below were decompsed into more granular stats.  Looking back
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2023 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2023 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2023-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -145,6 +145,8 @@ gv_namehead *targ_alloc(int keysize, mname_entry *gvent, gd_region *reg)
 	gvt->first_rec = (gv_key *)((char *)&gvt->clue + SIZEOF(gv_key) + keysize);
 	gvt->last_rec = (gv_key *)((char *)gvt->first_rec + SIZEOF(gv_key) + keysize);
 	gvt->prev_key = NULL;
+	gvt->get_cache = NULL;
+	gvt->thread_clues = NULL;
 	assert((UINTPTR_T)gvt->first_rec % SIZEOF(gvt->first_rec->top) == 0);
 	assert((UINTPTR_T)gvt->last_rec % SIZEOF(gvt->last_rec->top) == 0);
 	assert((UINTPTR_T)gvt->first_rec % SIZEOF(gvt->first_rec->end) == 0);
@@ -267,5 +269,14 @@ void	targ_free(gv_namehead *gvt)
 		free(gvt->alt_hist);
 	if (NULL != gvt->prev_key)
 		free(gvt->prev_key);
+	if (NULL != gvt->get_cache)
+	{
+		GVKEY_FREE_IF_NEEDED(gvt->get_cache->key);
+		if (NULL != gvt->get_cache->val)
+			free(gvt->get_cache->val);
+		free(gvt->get_cache);
+	}
+	if (NULL != gvt->thread_clues)
+		free(gvt->thread_clues);
 	free(gvt);
 }
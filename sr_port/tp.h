@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2023 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2023 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -170,6 +170,9 @@ typedef struct sgm_info_struct
 	jbuf_rsrv_struct_t	*jbuf_rsrv_ptr;		/* Pointer to structure corresponding to reservations on the journal
 							 * buffer for this region in current TP transaction.
 							 */
+	uint8			crit_grab_nsec;		/* CLOCK_MONOTONIC time (in nsec) when "tp_tend" grabbed crit on this
+							 * region to commit (0 if it did not). Used for the TCH statistic.
+							 */
 } sgm_info;
 
 /* Define macros to reflect the size of cw_index and next_off in the off_chain structure.
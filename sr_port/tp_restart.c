@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2022 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2024 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -234,10 +234,12 @@ int tp_restart(int newlevel, boolean_t handle_errors_internally)
 				gvname_mstr.addr = (char *)gvname_dirtree;
 				gvname_mstr.len = gvname_dirtree_len;
 			} else if ((cdb_sc_blkmod != status) || (tp_blkmod_tp_tend == TREF(blkmod_fail_type))
+								|| (tp_blkmod_tp_tend_precrit == TREF(blkmod_fail_type))
 								|| (tp_blkmod_op_tcommit == TREF(blkmod_fail_type)))
 			{	/* This is
 				 *   a) NOT a blkmod restart (i.e. a TP_TRACE_HIST call before or during TCOMMIT) OR
-				 *   b) a BLKMOD restart with type tp_blkmod_tp_tend (i.e. a TP_TRACE_HIST_MOD call from "tp_tend")
+				 *   b) a BLKMOD restart with type tp_blkmod_tp_tend or tp_blkmod_tp_tend_precrit (i.e. a
+				 *	TP_TRACE_HIST_MOD call from "tp_tend")
 				 *      (note that we cannot check TREF(blkmod_fail_type) unless it is a cdb_sc_blkmod).
 				 *   c) a BLKMOD restart with type tp_blkmod_op_tcommit (i.e. a TP_TRACE_HIST_MOD call from
 				 *	"t_qread" inside "op_tcommit").
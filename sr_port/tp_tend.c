@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2023 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2025 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -140,6 +140,7 @@ error_def(ERR_REPLOFFJNLON);
 error_def(ERR_TEXT);
 
 enum cdb_sc	reallocate_bitmap(sgm_info *si, cw_set_element *bml_cse);
+STATICFNDCL enum cdb_sc	tp_tend_precrit_validate(sgm_info *si);
 
 boolean_t	tp_crit_all_regions()
 {
@@ -285,6 +286,7 @@ boolean_t	tp_tend()
 #	endif
 	int4			tprestart_syslog_delta;
 	block_id		pvt_total_blks;
+	struct timespec		ts;
 	DCL_THREADGBL_ACCESS;
 
 	SETUP_THREADGBL_ACCESS;
@@ -463,6 +465,14 @@ boolean_t	tp_tend()
 				jnl_participants++;
 			}
 		}
+		if (!csa->now_crit && !is_mm)
+		{	/* Restart right away if the history has a block that the validation in crit will find modified */
+			if (cdb_sc_normal != (status = tp_tend_precrit_validate(si)))
+			{
+				INCR_GVSTATS_COUNTER(csa, cnl, n_tp_precrit_restarts, 1);
+				goto failed_skip_revert;
+			}
+		}
 		if (region_is_frozen)
 		{	/* Wait for it to be unfrozen before proceeding to commit. This reduces the
 			 * chances that we find it frozen after we grab crit further down below.
@@ -583,9 +593,12 @@ boolean_t	tp_tend()
 			 * restart with a helped out code because the cache recovery will most likely result in a restart of
 			 * the current transaction which we want to avoid if we are in the final retry.
 			 */
+			si->crit_grab_nsec = 0;
 			if (!csa->now_crit)
 			{
 				grab_crit(gv_cur_region, WS_54); /*Step CMT01 (see secshr_db_clnup.c for CMTxx step descriptions) */
+				clock_gettime(CLOCK_MONOTONIC, &ts);
+				si->crit_grab_nsec = ((uint8)ts.tv_sec * NANOSECS_IN_SEC) + ts.tv_nsec;
 			} else if (cnl->wc_blocked)
 			{
 				status = cdb_sc_helpedout;
@@ -1733,6 +1746,13 @@ boolean_t	tp_tend()
 			 * in case we are not updating this region as part of this TP transaction.
 			 */
 			rel_crit(si->gv_cur_region);	/* Step CMT14 */
+			if (si->crit_grab_nsec)
+			{
+				clock_gettime(CLOCK_MONOTONIC, &ts);
+				INCR_GVSTATS_COUNTER(si->tp_csa, si->tp_csa->nl, n_tp_crit_hold_nsec,
+					((uint8)ts.tv_sec * NANOSECS_IN_SEC) + ts.tv_nsec - si->crit_grab_nsec);
+				si->crit_grab_nsec = 0;
+			}
 		}
 	} /* for (si ... ) */
 	assert(cdb_sc_normal == status);
@@ -1849,6 +1869,13 @@ failed:
 			{
 				assert(!si->tp_csa->hold_onto_crit);
 				rel_crit(si->gv_cur_region);
+				if (si->crit_grab_nsec)
+				{	/* Crit held by a commit attempt that restarts counts as much as that of one that commits */
+					clock_gettime(CLOCK_MONOTONIC, &ts);
+					INCR_GVSTATS_COUNTER(si->tp_csa, si->tp_csa->nl, n_tp_crit_hold_nsec,
+						((uint8)ts.tv_sec * NANOSECS_IN_SEC) + ts.tv_nsec - si->crit_grab_nsec);
+					si->crit_grab_nsec = 0;
+				}
 			}
 		}
 		if (replication && repl_csa->now_crit && release_crit)
@@ -2097,3 +2124,35 @@ enum cdb_sc	reallocate_bitmap(sgm_info *si, cw_set_element *bml_cse)
 		bml_cse->ondsk_blkver = bml_cse->cr->ondsk_blkver;
 	return cdb_sc_normal;
 }
+
+/* Called by "tp_tend" (BG only) before it grabs crit on a region to commit. Looks for a block in the read history of the
+ * transaction that was certainly modified after it was read, i.e. one whose cache record still holds the block and has a
+ * block tn at or past the history tn, and which the validation in crit would therefore fail. Finding such a block here
+ * lets the transaction restart without holding up other processes in crit, and the pass also brings the history buffers
+ * into the CPU cache ahead of the validation in crit. Index blocks and NOISOLATION leaf blocks that the validation in crit
+ * might still accept (see the "indexmods" and "leafmods" logic there) are left to that validation.
+ */
+STATICFNDEF enum cdb_sc	tp_tend_precrit_validate(sgm_info *si)
+{
+	cache_rec_ptr_t		cr;
+	srch_blk_status		*t1;
+	trans_num		blktn;
+
+	for (t1 = si->first_tp_hist; t1 != si->last_tp_hist; t1++)
+	{
+		cr = t1->cr;
+		if ((NULL == cr) || (cr->cycle != t1->cycle) || (cr->blk != t1->blk_num))
+			continue;	/* buffer no longer holds the block read; only the validation in crit can tell */
+		if (t1->level ? (NULL == t1->cse) : (t1->blk_target->noisolation && (NULL != t1->cse)))
+			continue;
+		blktn = ((blk_hdr_ptr_t)t1->buffaddr)->tn;
+		if (t1->tn <= blktn)
+		{
+			assert(CDB_STAGNATE > t_tries);
+			TP_TRACE_HIST_MOD(t1->blk_num, t1->blk_target, tp_blkmod_tp_tend_precrit, cs_data, t1->tn, blktn,
+						t1->level);
+			return cdb_sc_blkmod;
+		}
+	}
+	return cdb_sc_normal;
+}
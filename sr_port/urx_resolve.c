@@ -2,7 +2,7 @@
  *								*
  * Copyright 2001, 2012 Fidelity Information Services, Inc	*
  *								*
- * Copyright (c) 2018 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -23,6 +23,8 @@ void urx_resolve(rhdtyp *rtn, lab_tabent *lbl_tab, lab_tabent *lbl_top)
 	urx_rtnref	*rp0, *rp1;
 	urx_labref	*lp0, *lp1;
 	urx_addr	*ap;
+	lab_tabent	*lab;
+	mident		lab_name;
 
 	if (!urx_getrtn(rtn->routine_name.addr, rtn->routine_name.len, &rp0, &rp1, &urx_anchor))
 		return;
@@ -37,31 +39,41 @@ void urx_resolve(rhdtyp *rtn, lab_tabent *lbl_tab, lab_tabent *lbl_top)
 		rp1->addr = ap->next;
 		free(ap);
 	}
-	while (lbl_tab < lbl_top)
+	/* Walk the (usually short) chain of unresolved labels of this routine and look each one up in the (sorted) label
+	 * table rather than walking every label of the routine and searching the chain for it. Labels that are not in the
+	 * table stay on the chain. See urx_getlab() for why "lp0" can be the routine node itself.
+	 */
+	lp0 = (urx_labref *)rp1;
+	lp1 = rp1->lab;
+	while (0 != lp1)
 	{
-		if (urx_getlab(lbl_tab->lab_name.addr, lbl_tab->lab_name.len, rp1, &lp0, &lp1))
+		lab_name.addr = (char *)&lp1->name[0];
+		lab_name.len = lp1->len;
+		if (NULL == (lab = find_lab_tabent(lbl_tab, lbl_top, &lab_name)))
 		{
-			while (0 != (ap = lp1->addr))	/* note the assignment! */
-			{
-				assert(0 == *ap->addr);
-				*ap->addr =
-					USHBIN_ONLY((INTPTR_T)&lbl_tab->lnr_adr)
-					/* on non-shared binary resolve this address by adding the offset stored at lbl_tab address
-					 * to the routine header, to arrive at the address at which the current line number entry is
-					 * stored
-					 */
-					NON_USHBIN_ONLY((INTPTR_T)&lbl_tab->lab_ln_ptr);
-				lp1->addr = ap->next;
-				free(ap);
-			}
-			assert(0 == lp1->addr);
-			if (lp0 == (urx_labref *)rp1)
-				((urx_rtnref *)lp0)->lab = lp1->next;
-			else
-				lp0->next = lp1->next;
-			free(lp1);
+			lp0 = lp1;
+			lp1 = lp1->next;
+			continue;
 		}
-		lbl_tab++;
+		while (0 != (ap = lp1->addr))	/* note the assignment! */
+		{
+			assert(0 == *ap->addr);
+			*ap->addr =
+				USHBIN_ONLY((INTPTR_T)&lab->lnr_adr)
+				/* on non-shared binary resolve this address by adding the offset stored at lab address
+				 * to the routine header, to arrive at the address at which the current line number entry is
+				 * stored
+				 */
+				NON_USHBIN_ONLY((INTPTR_T)&lab->lab_ln_ptr);
+			lp1->addr = ap->next;
+			free(ap);
+		}
+		if (lp0 == (urx_labref *)rp1)
+			((urx_rtnref *)lp0)->lab = lp1->next;
+		else
+			lp0->next = lp1->next;
+		free(lp1);
+		lp1 = (lp0 == (urx_labref *)rp1) ? ((urx_rtnref *)lp0)->lab : lp0->next;
 	}
 	if (0 == rp1->lab)
 	{
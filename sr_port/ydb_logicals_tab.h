@@ -1,6 +1,6 @@
 /****************************************************************
  *								*
- * Copyright (c) 2018-2024 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -52,6 +52,7 @@ YDBENVINDX_TABLE_ENTRY (YDBENVINDX_CRYPT_CONFIG,               "$ydb_crypt_confi
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_CRYPT_FIPS,                 "$ydb_crypt_fips",                 "$gtmcrypt_FIPS")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_CRYPT_PLUGIN,               "$ydb_crypt_plugin",               "$gtm_crypt_plugin")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_DB_CREATE_VER,              "$ydb_db_create_ver",              "$gtm_db_create_ver")
+YDBENVINDX_TABLE_ENTRY (YDBENVINDX_DB_EXTEND_HEADROOM,         "$ydb_db_extend_headroom",         "")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_CUSTOM_ERRORS,              "$ydb_custom_errors",              "$gtm_custom_errors")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_DBFILEXT_SYSLOG_DISABLE,    "$ydb_dbfilext_syslog_disable",    "$gtm_dbfilext_syslog_disable")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_DBGLVL,                     "$ydb_dbglvl",                     "$gtmdbglvl")
@@ -90,6 +91,7 @@ YDBENVINDX_TABLE_ENTRY (YDBENVINDX_LINKTMPDIR,                 "$ydb_linktmpdir"
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_LOCALE,                     "$ydb_locale",                     "$gtm_locale")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_LOCAL_COLLATE,              "$ydb_local_collate",              "$gtm_local_collate")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_LOG,                        "$ydb_log",                        "$gtm_log")
+YDBENVINDX_TABLE_ENTRY (YDBENVINDX_LOW_PRIORITY_READS,         "$ydb_low_priority_reads",         "")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_LVNULLSUBS,                 "$ydb_lvnullsubs",                 "$gtm_lvnullsubs")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_MAXTPTIME,                  "$ydb_maxtptime",                  "$gtm_zmaxtptime")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_MAX_INDRCACHE_COUNT,        "$ydb_max_indrcache_count",        "$gtm_max_indrcache_count")
@@ -127,6 +129,7 @@ YDBENVINDX_TABLE_ENTRY (YDBENVINDX_REPL_INSTNAME,              "$ydb_repl_instna
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_REPL_INSTSECONDARY,         "$ydb_repl_instsecondary",         "$gtm_repl_instsecondary")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_ROUTINES,                   "$ydb_routines",                   "$gtmroutines")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_SIDE_EFFECTS,               "$ydb_side_effects",               "$gtm_side_effects")
+YDBENVINDX_TABLE_ENTRY (YDBENVINDX_SOCKET_EPOLL_THRESHOLD,     "$ydb_socket_epoll_threshold",     "")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_SOCKET_KEEPALIVE_IDLE,      "$ydb_socket_keepalive_idle",      "$gtm_socket_keepalive_idle")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_SNAPTMPDIR,                 "$ydb_snaptmpdir",                 "$gtm_snaptmpdir")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_STATSDIR,                   "$ydb_statsdir",                   "$gtm_statsdir")
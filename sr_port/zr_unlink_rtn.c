@@ -3,7 +3,7 @@
  * Copyright (c) 2013-2022 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -55,6 +55,7 @@ void zr_unlink_rtn(rhdtyp *old_rhead, boolean_t free_all)
 	DCL_THREADGBL_ACCESS;
 
 	SETUP_THREADGBL_ACCESS;
+	(TREF(rtn_unlink_cycle))++;	/* Invalidate routine header/label addresses cached by call-ins */
 #	ifdef UNIX
 	DBGARLNK((stderr, "zr_unlink_rtn: Cleaning requested for routine %.*s (rtnhdr 0x"lvaddr")\n",
 		  old_rhead->routine_name.len, old_rhead->routine_name.addr, old_rhead));
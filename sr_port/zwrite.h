@@ -3,6 +3,9 @@
  * Copyright (c) 2001-2018 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
  *	This source code contains the intellectual property	*
  *	of its copyright holder(s), and is made available	*
  *	under a license.  If you do not know the terms of	*
@@ -159,6 +162,7 @@ typedef struct gvzwrite_datablk_struct
 void gvzwr_arg(int t, mval *a1, mval *a2);
 void gvzwr_init(unsigned short t, mval *val, int4 pat);
 void gvzwr_out(void);
+void gvzwr_out_val(mval *val);
 void gvzwr_var(uint4 data, int4 n);
 void lvzwr_arg(int t, mval *a1, mval *a2);
 void lvzwr_init(enum zwr_init_types t, mval *val);
@@ -3,6 +3,9 @@
  * Copyright (c) 2001-2021 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
  *	This source code contains the intellectual property	*
  *	of its copyright holder(s), and is made available	*
  *	under a license.  If you do not know the terms of	*
@@ -18,6 +21,25 @@
 #include "collseq.h"
 #include "do_xform.h"
 #include "memprot.h"
+#include "hashtab.h"
+
+/* Per-process cache of recent XFORM results for short strings. Collation transforms are pure functions of their input,
+ * so the result of a given collation sequence on a given string can be reused instead of calling into the (possibly
+ * expensive, e.g. ICU based) collation library again every time the same subscript is used.
+ */
+#define	XFORM_CACHE_ENTRIES	256	/* # of entries (power of 2) in the direct-mapped cache */
+#define	XFORM_CACHE_MAX_LEN	64	/* strings (and transforms) longer than this are not cached */
+
+typedef struct
+{
+	collseq		*csp;
+	int		in_len;
+	int		out_len;
+	char		in[XFORM_CACHE_MAX_LEN];
+	char		out[XFORM_CACHE_MAX_LEN];
+} xform_cache_entry;
+
+STATICDEF xform_cache_entry	*xform_cache;
 
 error_def(ERR_COLLARGLONG);
 error_def(ERR_COLTRANSSTR2LONG);
@@ -28,12 +50,32 @@ void do_xform(collseq *csp, int fc_type, mstr *input, mstr *output, int *length)
 	gtm_descriptor		outbuff, insub;
 	int4			status;
 	char			*ba, *addr;
+	uint4			hash;
+	xform_cache_entry	*xce;
 	DEBUG_ONLY(static boolean_t in_do_xform;)
 	DCL_THREADGBL_ACCESS;
 
 	SETUP_THREADGBL_ACCESS;
 	assert(!in_do_xform);
 	DO_XFORM_RETURN_IF_NULL_STRING(input, output, length);
+	xce = NULL;
+	if ((XFORM == fc_type) && (XFORM_CACHE_MAX_LEN >= input->len))
+	{
+		if (NULL == xform_cache)
+		{
+			xform_cache = (xform_cache_entry *)malloc(XFORM_CACHE_ENTRIES * SIZEOF(xform_cache_entry));
+			memset(xform_cache, 0, XFORM_CACHE_ENTRIES * SIZEOF(xform_cache_entry));
+		}
+		STR_HASH(input->addr, input->len, hash, 0);
+		xce = &xform_cache[hash & (XFORM_CACHE_ENTRIES - 1)];
+		if ((xce->csp == csp) && (xce->in_len == input->len) && !memcmp(xce->in, input->addr, input->len)
+			&& (xce->out_len <= output->len))
+		{
+			memcpy(output->addr, xce->out, xce->out_len);
+			*length = xce->out_len;
+			return;
+		}
+	}
 	DEBUG_ONLY(in_do_xform = TRUE;)
 	assert (0 == csp->argtype || 1 == csp->argtype);
 	assert(XFORM == fc_type || XBACK == fc_type);
@@ -114,4 +156,12 @@ void do_xform(collseq *csp, int fc_type, mstr *input, mstr *output, int *length)
 	DEBUG_ONLY(in_do_xform = FALSE;)
 	if (status)
 		rts_error_csa(CSA_ARG(NULL) VARLSTCNT(1) status);
+	if ((NULL != xce) && (XFORM_CACHE_MAX_LEN >= *length))
+	{
+		xce->csp = csp;
+		xce->in_len = input->len;
+		memcpy(xce->in, input->addr, input->len);
+		xce->out_len = *length;
+		memcpy(xce->out, output->addr, *length);
+	}
 }
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2023 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2025 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -1044,6 +1044,7 @@ callin_entry_list *citab_parse(boolean_t internal_use, char **fname)
 			entry_ptr->parms[i] = parameter_types[i];
 		put_mstr(&labref, &entry_ptr->label_ref);
 		put_mstr(&callnam, &entry_ptr->call_name);
+		entry_ptr->rtnhdr = NULL;	/* label_ref is resolved on the first call */
 	}
 	FCLOSE(ext_table_file_handle, fclose_res);
 	return entry_ptr;
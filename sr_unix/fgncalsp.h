@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2018 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2024 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -144,6 +144,15 @@ typedef struct callin_entry_list
 	enum ydb_types		return_type;
 	enum ydb_types		*parms;		/* parameter types */
 	struct callin_entry_list	*next_entry;
+	/* The following fields cache the result of resolving "label_ref" for the last call of this entry so repeated
+	 * calls can skip parsing the label reference and looking up the label. See "ci_resolve_label" for how they are used.
+	 */
+	mstr			routine;	/* routine name parsed out of "label_ref" */
+	mstr			label;		/* label name parsed out of "label_ref" */
+	struct rhead_struct	*rtnhdr;	/* routine header "lnr_adr" belongs to (NULL if nothing cached) */
+	int4			*lnr_adr;	/* line number table entry of the label */
+	boolean_t		has_parms;	/* whether the label has a formal list (TABENT_PROXY.has_parms) */
+	uint4			rtn_unlink_cycle;	/* TREF(rtn_unlink_cycle) when "rtnhdr" was cached */
 } callin_entry_list;
 
 /* parameter block that ci_restart uses to pass arguments to M routine */
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2023 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2024 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -23,6 +23,7 @@
 #endif
 #include <errno.h>
 #include "gtm_unistd.h"
+#include "gtm_fcntl.h"
 #include "gtm_signal.h"
 
 #include "buddy_list.h"
@@ -103,6 +104,7 @@ GBLREF	unsigned int		t_tries;
 GBLREF	jnl_gbls_t		jgbl;
 GBLREF	inctn_detail_t		inctn_detail;			/* holds detail to fill in to inctn jnl record */
 GBLREF	boolean_t		ydb_dbfilext_syslog_disable;	/* control whether db file extension message is logged or not */
+GBLREF	uint4			ydb_db_extend_headroom;		/* # of extensions to preallocate past the end of a db file */
 GBLREF	uint4			ydbDebugLevel;
 GBLREF	jnlpool_addrs_ptr_t	jnlpool;
 
@@ -144,6 +146,25 @@ STATICFNDEF int extend_wait_for_write(unix_db_info *udi, int blk_size, off_t new
 	return save_errno;
 }
 
+/* Reserve "len" bytes of disk space past "offset" (the current end of the database file) without changing the file size.
+ * The POSIX_FALLOCATE done in crit by a later extension then finds the space already allocated and only has to move the
+ * end of the file. This is best effort: any error (e.g. a file system that does not support it, or one short of space)
+ * is ignored since the later extension checks for and allocates the space it needs all over again.
+ */
+STATICFNDCL void extend_reserve_headroom(int fd, off_t offset, off_t len);
+STATICFNDEF void extend_reserve_headroom(int fd, off_t offset, off_t len)
+{
+#	ifdef FALLOC_FL_KEEP_SIZE
+	do
+	{
+		if ((0 == fallocate(fd, FALLOC_FL_KEEP_SIZE, offset, len)) || (EINTR != errno))
+			break;
+		eintr_handling_check();
+	} while (TRUE);
+	HANDLE_EINTR_OUTSIDE_SYSTEM_CALL;
+#	endif
+}
+
 int4 gdsfilext(block_id blocks, block_id filesize, boolean_t trans_in_prog)
 {
 	sm_uc_ptr_t		old_base[2] = { NULL, NULL }, mmap_retaddr;
@@ -163,6 +184,8 @@ int4 gdsfilext(block_id blocks, block_id filesize, boolean_t trans_in_prog)
 	cache_rec_ptr_t		cr;
 	jnlpool_addrs_ptr_t	local_jnlpool;	/* needed by INST_FREEZE_ON_NOSPC_ENABLED */
 	char			*db_file_name = "";
+	struct timespec		ts;
+	uint8			start_nsec;
 	DCL_THREADGBL_ACCESS;
 
 	SETUP_THREADGBL_ACCESS;
@@ -258,6 +281,8 @@ int4 gdsfilext(block_id blocks, block_id filesize, boolean_t trans_in_prog)
 	}
 #	endif
 	/* From here on, we need to use GDSFILEXT_CLNUP before returning to the caller */
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	start_nsec = ((uint8)ts.tv_sec * NANOSECS_IN_SEC) + ts.tv_nsec;
 	was_crit = cs_addrs->now_crit;
 	assert(!cs_addrs->hold_onto_crit || was_crit);
 	/* If we are coming from mupip_extend (which gets crit itself) we better have waited for any unfreezes to occur.
@@ -611,6 +636,16 @@ int4 gdsfilext(block_id blocks, block_id filesize, boolean_t trans_in_prog)
 		assert(cs_addrs->db_addrs[0] < cs_addrs->db_addrs[1]);
 	}
 	GDSFILEXT_CLNUP;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	INCR_GVSTATS_COUNTER(cs_addrs, cs_addrs->nl, n_db_extend_nsec,
+		((uint8)ts.tv_sec * NANOSECS_IN_SEC) + ts.tv_nsec - start_nsec);
+	if (ydb_db_extend_headroom && !was_crit && !is_mm && !cs_data->defer_allocate && cs_data->extension_size)
+	{	/* Now that crit is released, reserve the space for the next "ydb_db_extend_headroom" extensions (including
+		 * their bitmaps) so they do not have to allocate it while holding crit.
+		 */
+		extend_reserve_headroom(udi->fd, new_eof + cs_data->blk_size, (off_t)ydb_db_extend_headroom
+			* (cs_data->extension_size + DIVIDE_ROUND_UP(cs_data->extension_size, bplmap - 1)) * cs_data->blk_size);
+	}
 	INCR_GVSTATS_COUNTER(cs_addrs, cs_addrs->nl, n_db_extends, 1);
 	if (!ydb_dbfilext_syslog_disable)
 	{
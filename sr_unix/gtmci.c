@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2021 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2023 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -93,6 +93,8 @@ LITREF  gtmImageName            gtmImageNames[];
 
 void gtm_levl_ret_code(void);
 
+STATICFNDCL void ci_resolve_label(callin_entry_list *entry, mstr *label, rhdtyp **base_addr, char **xfer_addr);
+
 error_def(ERR_ACTLSTTOOLONG);
 error_def(ERR_CALLINAFTERXIT);
 error_def(ERR_CIMAXLEVELS);
@@ -197,6 +199,50 @@ callin_entry_list *ci_find_rtn_entry(ci_tab_entry_t *ci_tab, const char *call_na
 	return (callin_entry ? callin_entry->value : NULL);
 }
 
+/* Resolve the routine header and execution address of the label a call-in table entry refers to. The result is cached
+ * in the entry so repeated calls of the same entry only need to verify that the routine header found for the routine
+ * name is still the one cached (i.e. the routine was not relinked) and that no routine was unlinked since (which could
+ * have freed the cached header and let a new one be allocated at the same address). Otherwise this does the
+ * "lref_parse" + "job_addr" that would have been done on every call. In either case TABENT_PROXY is left set up the
+ * way "job_addr" leaves it.
+ */
+STATICFNDEF void ci_resolve_label(callin_entry_list *entry, mstr *label, rhdtyp **base_addr, char **xfer_addr)
+{
+	int		i;
+	DCL_THREADGBL_ACCESS;
+
+	SETUP_THREADGBL_ACCESS;
+	if ((NULL != entry->rtnhdr) && (TREF(rtn_unlink_cycle) == entry->rtn_unlink_cycle)
+		&& (entry->rtnhdr == find_rtn_hdr(&entry->routine)))
+	{
+#		ifdef USHBIN_SUPPORTED
+		ARLINK_ONLY((TABENT_PROXY).rtnhdr_adr = entry->rtnhdr);
+		(TABENT_PROXY).lnr_adr = entry->lnr_adr;
+#		else
+		(TABENT_PROXY).lab_ln_ptr = ((int4)entry->lnr_adr - (int4)entry->rtnhdr);
+#		endif
+		(TABENT_PROXY).has_parms = entry->has_parms;
+		*base_addr = entry->rtnhdr;
+		*xfer_addr = (char *)LINE_NUMBER_ADDR(entry->rtnhdr, entry->lnr_adr);
+		*label = entry->label;
+		return;
+	}
+	entry->rtnhdr = NULL;
+	lref_parse((unsigned char*)entry->label_ref.addr, &entry->routine, &entry->label, &i);
+	*label = entry->label;
+	/* 3rd argument is 0 because we don't support a line offset from a label in call-ins */
+	if (!job_addr(&entry->routine, label, 0, (char **)base_addr, xfer_addr))
+		RTS_ERROR_CSA_ABT(NULL, VARLSTCNT(1) ERR_JOBLABOFF);
+#	ifdef USHBIN_SUPPORTED
+	entry->lnr_adr = (TABENT_PROXY).lnr_adr;
+#	else
+	entry->lnr_adr = (int4 *)((char *)*base_addr + (TABENT_PROXY).lab_ln_ptr);
+#	endif
+	entry->has_parms = (TABENT_PROXY).has_parms;
+	entry->rtn_unlink_cycle = TREF(rtn_unlink_cycle);
+	entry->rtnhdr = *base_addr;
+}
+
 /* Java-specific version of call-in handler. */
 int ydb_cij(const char *c_rtn_name, char **arg_blob, int count, int *arg_types, unsigned int *io_vars_mask,
 	    unsigned int *has_ret_value)
@@ -204,7 +250,7 @@ int ydb_cij(const char *c_rtn_name, char **arg_blob, int count, int *arg_types,
 	callin_entry_list	*entry;
 	ci_tab_entry_t		*ci_tab;
 	int4			*lnr_tab_ent;
-	mstr			label, routine;
+	mstr			label;
 	int			has_return, i, len;
 	rhdtyp          	*base_addr;
 	char			*xfer_addr;
@@ -250,11 +296,8 @@ int ydb_cij(const char *c_rtn_name, char **arg_blob, int count, int *arg_types,
 				 * if this failed, would lead to a nested error which we'd like to avoid */
 	ESTABLISH_RET(gtmci_ch, mumps_status);
 	entry = ci_load_table_rtn_entry(c_rtn_name, &ci_tab);   /* load ci table, locate entry for return name */
-	lref_parse((unsigned char*)entry->label_ref.addr, &routine, &label, &i);
-	/* The 3rd argument is NULL because we will get lnr_adr via TABENT_PROXY. */
-	if (!job_addr(&routine, &label, 0, (char **)&base_addr, &xfer_addr))
-		RTS_ERROR_CSA_ABT(NULL, VARLSTCNT(1) ERR_JOBLABOFF);
-	/* Thejob_addr() call above has done a zlink of the routine we want to drive if needed and has give us
+	ci_resolve_label(entry, &label, &base_addr, &xfer_addr);
+	/* The ci_resolve_label() call above has done a zlink of the routine we want to drive if needed and has give us
 	 * the routine header and execution address we need. But it did not do an autorelink check so do that now
 	 * before we put these values into a stackframe as this call may change what is needing to go there.
 	 */
@@ -547,7 +590,7 @@ int ydb_ci_exec(const char *c_rtn_name, ci_name_descriptor *ci_info, va_list tem
 	callin_entry_list	*entry;
 	va_list			var;
 	int4			*lnr_tab_ent;
-	mstr			label, routine;
+	mstr			label;
 	int			has_return, i;
 	rhdtyp          	*base_addr;
 	char			*xfer_addr;
@@ -639,11 +682,8 @@ int ydb_ci_exec(const char *c_rtn_name, ci_name_descriptor *ci_info, va_list tem
 		if (NULL != ci_info)
 			ci_info->handle = entry;
 	}
-	lref_parse((unsigned char*)entry->label_ref.addr, &routine, &label, &i);
-	/* 3rd argument is 0 because we don't support a line offset from a label in call-ins */
-	if (!job_addr(&routine, &label, 0, (char **)&base_addr, &xfer_addr))
-		RTS_ERROR_CSA_ABT(NULL, VARLSTCNT(1) ERR_JOBLABOFF);
-	/* Thejob_addr() call above has done a zlink of the routine we want to drive if needed and has give us
+	ci_resolve_label(entry, &label, &base_addr, &xfer_addr);
+	/* The ci_resolve_label() call above has done a zlink of the routine we want to drive if needed and has give us
 	 * the routine header and execution address we need. But it did not do an autorelink check so do that now
 	 * before we put these values into a stackframe as this call may change what is needing to go there.
 	 */
@@ -3,7 +3,7 @@
  * Copyright (c) 2010-2023 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2025 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -117,6 +117,10 @@ STATICFNDCL	uint4		gvtr_process_pattern(char *ptr, uint4 len, gvtr_subs_t *subsd
 STATICFNDCL	uint4		gvtr_process_gvsubs(char *start, char *end, gvtr_subs_t *subsdsc,
 						    boolean_t colon_imbalance, gv_namehead *gvt);
 STATICFNDCL	boolean_t	gvtr_is_key_a_match(char *keysub_start[], gv_trigger_t *trigdsc, mval *lvvalarray[]);
+STATICFNDCL	int		gvtr_keycmp(char *key1, uint4 len1, char *key2, uint4 len2);
+STATICFNDCL	void		gvtr_build_match_index(gvt_trigger_t *gvt_trigger);
+STATICFNDCL	boolean_t	gvtr_match_index_candidates(gvtr_match_index_t *match_index, gvtr_cmd_type_t gvtr_cmd,
+						char *keysub_start[], uint4 keysubs, uint4 *candidates);
 
 #define TRIGGER_SUBSDEF(SUBSTYPE, SUBSNAME, LITMVALNAME, TRIGFILEQUAL, PARTOFHASH)	LITREF mval LITMVALNAME;
 #include "trigger_subs_def.h"
@@ -643,7 +647,7 @@ void	gvtr_db_read_hasht(sgmnt_addrs *csa)
 	boolean_t		save_gv_last_subsc_null, save_gv_some_subsc_null;
 	int4			tmpint4, util_len;
 	gvt_trigger_t		*gvt_trigger;
-	uint4			trigidx, num_gv_triggers, num_pieces, len, cmdtype, index, minpiece, maxpiece;
+	uint4			trigidx, num_gv_triggers, num_pieces, len, cmdtype, index, minpiece, maxpiece, piece;
 	gv_trigger_t		*gv_trig_array, *trigdsc, *trigtop;
 	uint4			currkey_end, cycle, numsubs, cursub, numlvsubs, curlvsub = -1;
 	char			ch, *ptr, *ptr_top, *ptr_start;
@@ -780,6 +784,7 @@ void	gvtr_db_read_hasht(sgmnt_addrs *csa)
 	gvt_trigger->gv_trigger_cycle = 0;
 	gvt_trigger->gv_trig_array = NULL;
 	gvt_trigger->gv_trig_list = NULL;
+	gvt_trigger->match_index = NULL;
 	/* Set gvt->gvt_trigger to this malloced memory (after gv_trig_array has been initialized to NULL to avoid garbage
 	 * values). If we encounter an error below, we will remember to free this up the next time we are in this function
 	 */
@@ -1097,6 +1102,12 @@ void	gvtr_db_read_hasht(sgmnt_addrs *csa)
 					ptr_start = ptr + 1;
 					trigdsc->piecearray[index].min = minpiece;
 					trigdsc->piecearray[index].max = maxpiece;
+					for (piece = MAX(minpiece, 1); piece <= maxpiece; piece++)
+					{
+						trigdsc->piecemask |= STRPIECEMASK_BIT(piece);
+						if (64 <= piece)
+							break;	/* all pieces from here on share the same bit */
+					}
 					minpiece = 0;
 					index++;
 				} else if (':' == *ptr)
@@ -1106,7 +1117,8 @@ void	gvtr_db_read_hasht(sgmnt_addrs *csa)
 				}
 			}
 			assert(index == num_pieces);
-		}
+		} else
+			trigdsc->piecemask = STRPIECEMASK_ALL;
 		/* Read in ^#t("GBL",1,"CHSET")="UTF-8". If CHSET does not match ydb_chset issue error. */
 		is_defined =  gvtr_get_hasht_gblsubs((mval *)&literal_chset, ret_mval);
 		if (!is_defined)
@@ -1157,6 +1169,7 @@ void	gvtr_db_read_hasht(sgmnt_addrs *csa)
 		}
 	}
 	gvt_trigger->gv_trig_top = trigdsc;	/* Very top of the array */
+	gvtr_build_match_index(gvt_trigger);
 #	ifdef DEBUG	/* Verify that the queues are well built */
 	{
 		cntset = cntkill = cntztrig = 0;
@@ -1300,6 +1313,152 @@ STATICFNDEF	boolean_t	gvtr_is_key_a_match(char *keysub_start[], gv_trigger_t *tr
 	return TRUE;
 }
 
+/* Compares two subscripts in database key format the same way "gvtr_is_key_a_match" does for RANGE type subscripts */
+STATICFNDEF	int	gvtr_keycmp(char *key1, uint4 len1, char *key2, uint4 len2)
+{
+	int	cmpres;
+
+	cmpres = memcmp(key1, key2, MIN(len1, len2));
+	if (0 == cmpres)
+		cmpres = (len1 < len2) ? -1 : ((len1 > len2) ? 1 : 0);
+	return cmpres;
+}
+
+/* Builds gvt_trigger->match_index from the triggers that were just read in. The index records, for each command type,
+ * the # of subscripts that triggers have and, for triggers whose first subscript is a list of POINTs and/or RANGEs, each
+ * such POINT/RANGE in an array sorted on the lower end. This lets "gvtr_match_n_invoke" find the triggers that could match
+ * an updated node with a binary search instead of running "gvtr_is_key_a_match" against every trigger of the global.
+ */
+STATICFNDEF	void	gvtr_build_match_index(gvt_trigger_t *gvt_trigger)
+{
+	gvtr_match_index_t	*match_index;
+	gvtr_sub0_bound_t	*bounds, tmpbound;
+	gv_trigger_t		*trigdsc;
+	gvtr_subs_t		*subsdsc;
+	uint4			trigidx, num_bounds, cmdtype, ii, jj, maxidx;
+	boolean_t		is_unbounded;
+
+	gvt_trigger->match_index = NULL;
+	if (GVTR_MATCH_INDEX_MAX_TRIGGERS < gvt_trigger->num_gv_triggers)
+		return;		/* Not worth the bitmap space; "gvtr_match_n_invoke" scans all triggers like before */
+	match_index = (gvtr_match_index_t *)get_new_element(gvt_trigger->gv_trig_list,
+							DIVIDE_ROUND_UP(SIZEOF(gvtr_match_index_t), GVTR_LIST_ELE_SIZE));
+	memset(match_index, 0, SIZEOF(gvtr_match_index_t));
+	/* First pass : fill in "numsubs_mask" and "unbounded" and count the POINTs/RANGEs */
+	num_bounds = 0;
+	for (trigidx = 0; trigidx < gvt_trigger->num_gv_triggers; trigidx++)
+	{
+		trigdsc = &gvt_trigger->gv_trig_array[trigidx];
+		assert(MAX_GVSUBSCRIPTS >= trigdsc->numsubs);
+		for (cmdtype = 0; cmdtype < GVTR_CMDTYPES; cmdtype++)
+		{
+			if (trigdsc->cmdmask & gvtr_cmd_mask[cmdtype])
+				match_index->numsubs_mask[cmdtype] |= ((uint4)1 << trigdsc->numsubs);
+		}
+		is_unbounded = (0 == trigdsc->numsubs);
+		for (subsdsc = trigdsc->subsarray; !is_unbounded && (NULL != subsdsc); subsdsc = subsdsc->gvtr_subs_range.next_range)
+		{
+			if ((GVTR_SUBS_POINT == subsdsc->gvtr_subs_type) || (GVTR_SUBS_RANGE == subsdsc->gvtr_subs_type))
+				num_bounds++;
+			else
+				is_unbounded = TRUE;
+		}
+		if (is_unbounded)
+			GVTR_MATCH_INDEX_SET(match_index->unbounded, trigidx);
+	}
+	/* Second pass : record the POINTs/RANGEs of the triggers that are not "unbounded" */
+	bounds = NULL;
+	if (num_bounds)
+		bounds = (gvtr_sub0_bound_t *)get_new_element(gvt_trigger->gv_trig_list,
+							DIVIDE_ROUND_UP(num_bounds * SIZEOF(gvtr_sub0_bound_t), GVTR_LIST_ELE_SIZE));
+	num_bounds = 0;
+	for (trigidx = 0; trigidx < gvt_trigger->num_gv_triggers; trigidx++)
+	{
+		if (GVTR_MATCH_INDEX_ISSET(match_index->unbounded, trigidx))
+			continue;
+		for (subsdsc = gvt_trigger->gv_trig_array[trigidx].subsarray; NULL != subsdsc;
+				subsdsc = subsdsc->gvtr_subs_range.next_range)
+		{
+			if (GVTR_SUBS_POINT == subsdsc->gvtr_subs_type)
+			{
+				tmpbound.key1 = tmpbound.key2 = subsdsc->gvtr_subs_point.subs_key;
+				tmpbound.len1 = tmpbound.len2 = subsdsc->gvtr_subs_point.len;
+			} else
+			{
+				assert(GVTR_SUBS_RANGE == subsdsc->gvtr_subs_type);
+				tmpbound.len1 = subsdsc->gvtr_subs_range.len1;
+				tmpbound.key1 = (GVTR_RANGE_OPEN_LEN == tmpbound.len1) ? NULL : subsdsc->gvtr_subs_range.subs_key1;
+				tmpbound.len2 = subsdsc->gvtr_subs_range.len2;
+				tmpbound.key2 = (GVTR_RANGE_OPEN_LEN == tmpbound.len2) ? NULL : subsdsc->gvtr_subs_range.subs_key2;
+			}
+			tmpbound.trigidx = trigidx;
+			/* Insertion sort on "key1". The # of entries is small and this is done only when triggers are (re)loaded */
+			for (jj = num_bounds; (0 < jj) && (NULL != bounds[jj - 1].key1) && ((NULL == tmpbound.key1)
+					|| (0 < gvtr_keycmp(bounds[jj - 1].key1, bounds[jj - 1].len1, tmpbound.key1, tmpbound.len1)));
+					jj--)
+				bounds[jj] = bounds[jj - 1];
+			bounds[jj] = tmpbound;
+			num_bounds++;
+		}
+	}
+	/* Note down the running maximum of "key2" so a lookup knows when no earlier entry can contain the subscript */
+	for (ii = 0, maxidx = 0; ii < num_bounds; ii++)
+	{
+		if ((NULL != bounds[maxidx].key2) && ((NULL == bounds[ii].key2)
+				|| (0 < gvtr_keycmp(bounds[ii].key2, bounds[ii].len2, bounds[maxidx].key2, bounds[maxidx].len2))))
+			maxidx = ii;
+		bounds[ii].maxidx = maxidx;
+	}
+	match_index->num_bounds = num_bounds;
+	match_index->bounds = bounds;
+	gvt_trigger->match_index = match_index;
+}
+
+/* Fills "candidates" with the triggers that could match a node with "keysubs" subscripts (parsed into "keysub_start")
+ * based on the first subscript alone. Returns FALSE if no trigger of type "gvtr_cmd" can possibly match the node.
+ */
+STATICFNDEF	boolean_t	gvtr_match_index_candidates(gvtr_match_index_t *match_index, gvtr_cmd_type_t gvtr_cmd,
+							char *keysub_start[], uint4 keysubs, uint4 *candidates)
+{
+	gvtr_sub0_bound_t	*bounds, *bound;
+	char			*sub;
+	uint4			sublen, lo, hi, mid, ii, word;
+	boolean_t		any;
+
+	if ((MAX_GVSUBSCRIPTS < keysubs) || !(match_index->numsubs_mask[gvtr_cmd] & ((uint4)1 << keysubs)))
+		return FALSE;
+	memcpy(candidates, match_index->unbounded, SIZEOF(match_index->unbounded));
+	if (keysubs)
+	{
+		sub = keysub_start[0];
+		sublen = UINTCAST(keysub_start[1] - sub);
+		bounds = match_index->bounds;
+		/* Find the # of entries whose lower end is <= the subscript. Entries with an open lower end sort first. */
+		for (lo = 0, hi = match_index->num_bounds; lo < hi; )
+		{
+			mid = (lo + hi) / 2;
+			bound = &bounds[mid];
+			if ((NULL == bound->key1) || (0 >= gvtr_keycmp(bound->key1, bound->len1, sub, sublen)))
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+		/* Of those, the ones whose upper end is >= the subscript contain it. Stop once no earlier entry can. */
+		for (ii = lo; 0 < ii--; )
+		{
+			bound = &bounds[bounds[ii].maxidx];
+			if ((NULL != bound->key2) && (0 > gvtr_keycmp(bound->key2, bound->len2, sub, sublen)))
+				break;
+			bound = &bounds[ii];
+			if ((NULL == bound->key2) || (0 <= gvtr_keycmp(bound->key2, bound->len2, sub, sublen)))
+				GVTR_MATCH_INDEX_SET(candidates, bound->trigidx);
+		}
+	}
+	for (any = FALSE, word = 0; word < GVTR_MATCH_INDEX_WORDS; word++)
+		any |= (0 != candidates[word]);
+	return any;
+}
+
 void	gvtr_free(gv_namehead *gvt)
 {
 	gvt_trigger_t		*gvt_trigger;
@@ -1329,6 +1488,7 @@ void	gvtr_free(gv_namehead *gvt)
 		cleanup_list(gv_trig_list);
 		free(gv_trig_list);
 		gvt_trigger->gv_trig_list = NULL;
+		gvt_trigger->match_index = NULL;	/* was allocated from "gv_trig_list" */
 	}
 	free(gvt_trigger);
 	gvt->gvt_trigger = NULL;
@@ -1495,6 +1655,11 @@ int	gvtr_match_n_invoke(gtm_trigger_parms *trigparms, gvtr_invoke_parms_t *gvtr_
 	mval			tmpmval;
 	unsigned char		util_buff[MAX_TRIG_UTIL_LEN];
 	int4			util_len;
+	gvtr_match_index_t	*match_index;
+	uint4			candidates[GVTR_MATCH_INDEX_WORDS];
+	uint8			changed_pieces;
+	int			changed_pieces_delim;
+	boolean_t		use_matchc;
 #	ifdef DEBUG
 	sgmnt_addrs		*csa;
 	sgmnt_data_ptr_t	csd;
@@ -1567,6 +1732,15 @@ int	gvtr_match_n_invoke(gtm_trigger_parms *trigparms, gvtr_invoke_parms_t *gvtr_
 	assert(NULL == lvvalarray[keysubs]);
 	DEBUG_ONLY(keylen = INTCAST(key_end - key_start));
 	assert(!keysubs || keylen);
+	/* Use the index (if any) to find the triggers that can match this node and return right away if there are none */
+	match_index = gvt_trigger->match_index;
+	if ((NULL != match_index) && !gvtr_match_index_candidates(match_index, gvtr_cmd, keysub_start, keysubs, candidates))
+	{
+		gvtr_parms->num_triggers_invoked = 0;
+		return 0;
+	}
+	changed_pieces_delim = -1;	/* "changed_pieces" not yet computed */
+	changed_pieces = STRPIECEMASK_ALL;
 	/* Match & Invoke triggers. Take care to ensure they are invoked in an UNPREDICTABLE order.
 	 * Current implementation is to invoke triggers in a rotating order. For example, each command
 	 * type is in a circular queue - say A, B, C. Each time we come here to drive triggers for this
@@ -1601,6 +1775,8 @@ int	gvtr_match_n_invoke(gtm_trigger_parms *trigparms, gvtr_invoke_parms_t *gvtr_
 		assert((trigdsc->cmdmask & gvtr_cmd_mask[gvtr_cmd]) || !is_set_trigger);
 		if (!is_set_trigger && !is_ztrig_trigger && !(trigdsc->cmdmask & gvtr_cmd_mask[gvtr_cmd]))
 			continue; /* Trigger is for different command. Currently only possible for KILL/ZKILL (asserted above) */
+		if ((NULL != match_index) && !GVTR_MATCH_INDEX_ISSET(candidates, trigdsc - gvt_trigger->gv_trig_array))
+			continue; /* First subscript of the node is not one this trigger accepts */
 		/* Check that global variables which could have been modified inside gvcst_put/gvcst_kill have been
 		 * reset to their default values before going into trigger code as that could cause a nested call to
 		 * gvcst_put/gvcst_kill and we dont want any non-default value of this global variable from the parent
@@ -1644,9 +1820,25 @@ int	gvtr_match_n_invoke(gtm_trigger_parms *trigparms, gvtr_invoke_parms_t *gvtr_
 				{
 					assert(0 == ztupd_mval->mvtype);
 					assert(ztupd_mstr);
-					strpiecediff(&trigparms->ztoldval_new->str, &trigparms->ztvalue_new->str,
-						&trigdsc->delimiter.str, trigdsc->numpieces, trigdsc->piecearray,
-						!trigdsc->is_zdelim && gtm_utf8_mode, ztupd_mstr);
+					use_matchc = !trigdsc->is_zdelim && gtm_utf8_mode;
+					/* Compute (once per delimiter) a superset of the pieces that changed so triggers whose
+					 * pieces of interest did not change can be skipped without a "strpiecediff" call.
+					 */
+					if ((1 == trigdsc->delimiter.str.len)
+						&& (changed_pieces_delim != (int)(*(unsigned char *)trigdsc->delimiter.str.addr
+											| (use_matchc << 8))))
+					{
+						changed_pieces_delim = (int)(*(unsigned char *)trigdsc->delimiter.str.addr
+											| (use_matchc << 8));
+						changed_pieces = strpiecemask(&trigparms->ztoldval_new->str,
+								&trigparms->ztvalue_new->str, &trigdsc->delimiter.str, use_matchc);
+					}
+					if ((1 == trigdsc->delimiter.str.len) && !(changed_pieces & trigdsc->piecemask))
+						ztupd_mstr->len = 0;
+					else
+						strpiecediff(&trigparms->ztoldval_new->str, &trigparms->ztvalue_new->str,
+							&trigdsc->delimiter.str, trigdsc->numpieces, trigdsc->piecearray,
+							use_matchc, ztupd_mstr);
 					if (!ztupd_mstr->len)
 					{	/* No pieces of interest changed. So dont invoke trigger. */
 						DBGTRIGR((stderr, "gvtr_match_n_invoke: Turning off ok_to_invoke_trigger #1\n"));
@@ -1690,6 +1882,7 @@ int	gvtr_match_n_invoke(gtm_trigger_parms *trigparms, gvtr_invoke_parms_t *gvtr_
 				}
 				gtm_trig_status = gtm_trigger(trigdsc, trigparms);
 				/* note: the above call may update trigparms->ztvalue_new for SET type triggers */
+				changed_pieces_delim = -1;	/* so "changed_pieces" is recomputed against the new $ZTVALUE */
 				assert(lcl_gtm_trigger_depth == gtm_trigger_depth);
 				num_triggers_invoked++;
 				ztupd_mval->mvtype = 0;	/* so stp_gcol -if invoked somehow - can free up any space
@@ -3,7 +3,7 @@
  * Copyright (c) 2010-2021 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2021 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -115,6 +115,8 @@ typedef struct gv_trigger_struct
 	uint4		numlvsubs;	/* # of subscripts for which the trigger requested a local variable name to be bound.
 					 * i.e. numlvsubs <= numsubs is always true. */
 	uint4		numpieces;	/* # of contiguous piece ranges specified in the trigger */
+	uint8		piecemask;	/* STRPIECEMASK_BIT() of every piece in "piecearray" (STRPIECEMASK_ALL if no "PIECES").
+					 * Lets a SET skip "strpiecediff" when none of the pieces of interest changed. */
 	gvtr_subs_t	*subsarray;	/* pointer to an array of "numsubs" number of gvtr_subs_t structures.
 					 * NULL if no subscript specified in the trigger (i.e. numsubs = 0) and is very unusual. */
 	uint4		*lvindexarray;	/* pointer to an array of "numlvsubs" number of uint4 type fields which contain the index
@@ -140,6 +142,36 @@ typedef struct gv_trigger_struct
 					 * additional lookup */
 } gv_trigger_t;
 
+/* Index built by gvtr_db_read_hasht() so an update does not need to test every trigger of the global. Only built if the
+ * global has at most GVTR_MATCH_INDEX_MAX_TRIGGERS triggers; candidate triggers are then tracked as a bitmap of
+ * indexes into "gv_trig_array".
+ */
+#define	GVTR_MATCH_INDEX_MAX_TRIGGERS	256
+#define	GVTR_MATCH_INDEX_WORDS		(GVTR_MATCH_INDEX_MAX_TRIGGERS / BITS_PER_UCHAR / SIZEOF(uint4))
+
+#define	GVTR_MATCH_INDEX_SET(BITMAP, TRIGIDX)	((BITMAP)[(TRIGIDX) / 32] |= ((uint4)1 << ((TRIGIDX) % 32)))
+#define	GVTR_MATCH_INDEX_ISSET(BITMAP, TRIGIDX)	(0 != ((BITMAP)[(TRIGIDX) / 32] & ((uint4)1 << ((TRIGIDX) % 32))))
+
+/* One POINT or RANGE that the first subscript of a trigger accepts (a trigger with a list of these has one entry for each) */
+typedef struct gvtr_sub0_bound_struct
+{
+	char	*key1;		/* lower end of the range (inclusive) in database key format; NULL if the range is open on the left */
+	char	*key2;		/* upper end of the range (inclusive) in database key format; NULL if the range is open on the right */
+	uint4	len1;
+	uint4	len2;
+	uint4	trigidx;	/* index of the owning trigger in "gv_trig_array" */
+	uint4	maxidx;		/* index of the entry with the highest "key2" among entries 0 thru this one (in sorted order) */
+} gvtr_sub0_bound_t;
+
+typedef struct gvtr_match_index_struct
+{
+	uint4			numsubs_mask[GVTR_CMDTYPES];	/* bit N set if a trigger for that command type has N subscripts */
+	uint4			unbounded[GVTR_MATCH_INDEX_WORDS]; /* triggers whose first subscript is not a list of POINTs and
+								    * RANGEs (i.e. "*" or a pattern) or that have no subscripts */
+	uint4			num_bounds;	/* # of entries in "bounds" */
+	gvtr_sub0_bound_t	*bounds;	/* sorted on "key1" (open left end first) */
+} gvtr_match_index_t;
+
 /* Structure describing ALL triggers for a given global variable name */
 typedef struct gvt_trigger_struct
 {
@@ -152,6 +184,7 @@ typedef struct gvt_trigger_struct
 	gv_trigger_t			*gv_trig_top;		/* top of the array of triggers */
 	struct buddy_list_struct	*gv_trig_list;		/* buddy list that maintains mallocs done inside gv_trig_array */
 	gv_trigger_t			*gv_trig_array;		/* array of triggers read in from ^#t(<gbl>,...) */
+	gvtr_match_index_t		*match_index;		/* NULL if too many triggers; allocated from "gv_trig_list" */
 } gvt_trigger_t;
 
 /* Structure describing parameters passed (from gvcst_put/gvcst_kill) to trigger invocation routine */
@@ -0,0 +1,120 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+#include "mdef.h"
+
+#include "gtm_string.h"
+
+#include "min_max.h"
+#include "gdsroot.h"
+#include "gtm_facility.h"
+#include "fileinfo.h"
+#include "gdsbt.h"
+#include "gdsfhead.h"
+#include "gvt_thread_clue.h"
+
+/* Make sure the clue in "gvt" is the one left by the last search of this global done by the current thread (see comment
+ * in gvt_thread_clue.h for why). Invoked with the YottaDB engine lock held so no other thread touches "gvt" meanwhile.
+ */
+void gvt_thread_clue_switch(gv_namehead *gvt)
+{
+	gvt_thread_clues	*clues;
+	gvt_thread_clue		*slot, *slot_top, *owner_slot, *self_slot, *free_slot;
+	pthread_t		self;
+	sgmnt_addrs		*csa;
+	node_local_ptr_t	cnl;
+	int4			keys_size;
+	int			i;
+
+	self = pthread_self();
+	clues = gvt->thread_clues;
+	if (NULL == clues)
+	{	/* First SimpleThreadAPI reference to this global. Nothing to stash yet, just note who owns the clue. */
+		keys_size = (int4)(3 * (SIZEOF(gv_key) + gvt->clue.top));
+		assert(((char *)gvt->last_rec + SIZEOF(gv_key) + gvt->clue.top) == ((char *)&gvt->clue + keys_size));
+		clues = (gvt_thread_clues *)malloc(SIZEOF(gvt_thread_clues) + (GVT_THREAD_CLUE_SLOTS * keys_size));
+		clues->keys_size = keys_size;
+		clues->next_slot = 0;
+		for (i = 0; i < GVT_THREAD_CLUE_SLOTS; i++)
+		{
+			clues->slot[i].valid = FALSE;
+			clues->slot[i].keys = (char *)(clues + 1) + (i * keys_size);
+		}
+		clues->clue_owner = self;
+		gvt->thread_clues = clues;
+		return;
+	}
+	if (pthread_equal(clues->clue_owner, self))
+		return;		/* The clue is from this thread's own last search of this global. This is the common case. */
+	csa = gvt->gd_csa;
+	assert(NULL != csa);
+	if (dba_bg != csa->hdr->acc_meth)
+	{	/* With MM, the search history points into the mapped file which can get remapped (e.g. by a file extension)
+		 * in between so a stashed history cannot be relied upon. Just take over the clue as it is.
+		 */
+		clues->clue_owner = self;
+		return;
+	}
+	cnl = csa->nl;
+	owner_slot = self_slot = free_slot = NULL;
+	for (slot = &clues->slot[0], slot_top = slot + GVT_THREAD_CLUE_SLOTS; slot < slot_top; slot++)
+	{
+		if (!slot->valid)
+		{
+			if (NULL == free_slot)
+				free_slot = slot;
+		} else if (pthread_equal(slot->thread_id, self))
+			self_slot = slot;
+		else if (pthread_equal(slot->thread_id, clues->clue_owner))
+			owner_slot = slot;
+	}
+	if (0 != gvt->clue.end)
+	{	/* Stash the clue of the thread that owns it for when that thread next reads this global. Reuse its own slot if
+		 * it has one, else a free slot, else the next one in round-robin order (but never the slot of this thread as
+		 * that is about to be put back below).
+		 */
+		slot = owner_slot;
+		if (NULL == slot)
+			slot = free_slot;
+		if (NULL == slot)
+		{
+			i = clues->next_slot;
+			if (&clues->slot[i] == self_slot)
+				i = (i + 1) % GVT_THREAD_CLUE_SLOTS;
+			slot = &clues->slot[i];
+			clues->next_slot = (i + 1) % GVT_THREAD_CLUE_SLOTS;
+		}
+		assert(slot != self_slot);
+		slot->thread_id = clues->clue_owner;
+		slot->root = gvt->root;
+		slot->onln_rlbk_cycle = cnl->onln_rlbk_cycle;
+		memcpy(slot->keys, (char *)&gvt->clue, clues->keys_size);
+		slot->hist = gvt->hist;
+		slot->valid = TRUE;
+	} else if (NULL != owner_slot)
+		owner_slot->valid = FALSE;	/* Owner's stashed clue is older than what it has since done with the gv_target */
+	if (NULL != self_slot)
+	{	/* Put back this thread's clue. It is not used if the global was killed and recreated (root changed) or an online
+		 * rollback happened since it was stashed. Everything else (a block that got modified or a global buffer that got
+		 * reused for another block) is caught by the clue validation in "gvcst_search".
+		 */
+		self_slot->valid = FALSE;
+		if ((0 != gvt->root) && (self_slot->root == gvt->root) && (self_slot->onln_rlbk_cycle == cnl->onln_rlbk_cycle))
+		{
+			memcpy((char *)&gvt->clue, self_slot->keys, clues->keys_size);
+			gvt->hist = self_slot->hist;
+			GVT_CLUE_INVALIDATE_PREV_KEY(gvt);	/* prev_key is not stashed so recompute it if $zprevious needs it */
+			DEBUG_GVT_CLUE_VALIDATE(gvt);
+		}
+	}
+	clues->clue_owner = self;
+}
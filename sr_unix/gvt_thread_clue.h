@@ -0,0 +1,61 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+#ifndef GVT_THREAD_CLUE_H_INCLUDED
+#define GVT_THREAD_CLUE_H_INCLUDED
+
+#include <pthread.h>
+
+/* With the SimpleThreadAPI, all threads share the one gv_target of a global and so its clue only ever reflects the search
+ * of whichever thread last accessed that global. Threads that interleave reads of the same global therefore keep throwing
+ * away each other's leaf position and every read ends up doing a full traversal from the root. To avoid that, when a thread
+ * finds the clue of a gv_target was left there by a different thread, it stashes that clue (keys and search history) away
+ * for the owning thread and puts back the clue it stashed for itself the last time it lost the gv_target to another thread.
+ * A clue that is put back is validated by "gvcst_search" like any other clue (block transaction numbers and cache record
+ * cycles) so it is never used if the blocks it points to have changed since.
+ */
+#define	GVT_THREAD_CLUE_SLOTS	8	/* number of threads per global whose clue is kept when they lose the gv_target */
+
+typedef struct	gvt_thread_clue_struct
+{
+	pthread_t	thread_id;		/* thread whose search built this clue */
+	boolean_t	valid;			/* FALSE if this slot is unused or its clue was already put back */
+	uint4		onln_rlbk_cycle;	/* cnl->onln_rlbk_cycle when the clue was stashed */
+	block_id	root;			/* gvt->root when the clue was stashed */
+	char		*keys;			/* copy of gvt->clue, gvt->first_rec and gvt->last_rec (contiguous in gvt) */
+	srch_hist	hist;			/* copy of gvt->hist */
+} gvt_thread_clue;
+
+typedef struct	gvt_thread_clues_struct
+{
+	pthread_t	clue_owner;		/* thread whose search the clue in the gv_target currently reflects */
+	int4		keys_size;		/* size of the clue, first_rec and last_rec keys of the gv_target together */
+	int4		next_slot;		/* next slot to reuse when all are taken by other threads */
+	gvt_thread_clue	slot[GVT_THREAD_CLUE_SLOTS];
+} gvt_thread_clues;
+
+/* Invoked by the SimpleAPI get routines once "op_gvname" has set up gv_target and before the database is searched. Only
+ * done outside of TP since a TP transaction is the business of one thread at a time anyway and its clues carry state that
+ * is only valid for the current transaction.
+ */
+#define	GVT_THREAD_CLUE_SWITCH_IF_NEEDED(GVT)							\
+MBSTART {											\
+	GBLREF	boolean_t	simpleThreadAPI_active;						\
+	GBLREF	uint4		dollar_tlevel;							\
+												\
+	if (simpleThreadAPI_active && !dollar_tlevel && (NULL != (GVT)))			\
+		gvt_thread_clue_switch(GVT);							\
+} MBEND
+
+void	gvt_thread_clue_switch(gv_namehead *gvt);
+
+#endif
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2023 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2020 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -921,9 +921,9 @@ STATICFNDEF boolean_t addr_fix(int file, unsigned char *shdr, linktype linktyp,
 	unsigned int		sym_size;
 	ssize_t			status;
 	mident_fixed		rtnid, labid;
-	mstr			rtn_str;
+	mstr			lab_str, rtn_str;
 	rhdtyp			*rtn;
-	lab_tabent		*label, *labtop;
+	lab_tabent		*label;
 	boolean_t		labsym;
 	urx_rtnref		*urx_rp;
 	urx_addr		*urx_tmpaddr;
@@ -1107,12 +1107,10 @@ STATICFNDEF boolean_t addr_fix(int file, unsigned char *shdr, linktype linktyp,
 				res_addr = (unsigned char *)rtn;	/* Resolve to routine header */
 			else
 			{	/* Look our target label up in the routines label table */
-				label = rtn->labtab_adr;
-				labtop = label + rtn->labtab_len;
-				for (; label < labtop && ((sym_size != (unsigned int)label->lab_name.len) ||
-							  memcmp(&labid.c[0], label->lab_name.addr, sym_size)); label++)
-					;
-				if (label < labtop)
+				lab_str.addr = &labid.c[0];
+				lab_str.len = sym_size;
+				label = find_lab_tabent(rtn->labtab_adr, rtn->labtab_adr + rtn->labtab_len, &lab_str);
+				if (NULL != label)
 					res_addr = (unsigned char *)&label->lnr_adr; /* Resolve to label entry address */
 				else
 					res_addr = NULL;	/* Label not found .. potential future problem. For now
@@ -0,0 +1,153 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+/* iosocket_epoll.c - maintain the epoll set used by iosocket_wait() for SOCKET devices with many sockets */
+
+#include "mdef.h"
+
+#include <errno.h>
+#include "gtm_socket.h"
+#include "gtm_inet.h"
+#include "gtm_string.h"
+#include "gtm_unistd.h"
+
+#include "gtmio.h"
+#include "io.h"
+#include "gt_timer.h"
+#include "iosocketdef.h"
+#include "iosocket_epoll.h"
+#include "eintr_wrappers.h"
+
+error_def(ERR_SOCKWAIT);
+error_def(ERR_TEXT);
+
+#define ISSUE_SOCKWAIT_ERROR(SAVE_ERRNO)								\
+MBSTART {												\
+	char	*errptr;										\
+	int4	errlen;											\
+													\
+	SET_ERRPTR_AND_ERRLEN(SAVE_ERRNO, errptr, errlen);						\
+	rts_error_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_SOCKWAIT, 0, ERR_TEXT, 2, errlen, errptr);		\
+} MBEND
+
+/* Create the epoll instance for the device if it does not exist. An instance inherited across a fork() is shared with the
+ * parent, so a child discards (without touching the interest list) and recreates it.
+ */
+STATICFNDEF void iosocket_epoll_init(d_socket_struct *dsocketptr)
+{
+	int	ii, fd, rc;
+	pid_t	pid;
+
+	pid = getpid();
+	if (dsocketptr->epoll_active)
+	{
+		if (pid == dsocketptr->epoll_pid)
+			return;
+		CLOSEFILE(dsocketptr->epoll_fd, rc);
+		dsocketptr->epoll_active = FALSE;
+		for (ii = 0; ii < dsocketptr->n_socket; ii++)
+			dsocketptr->socket[ii]->epoll_events = 0;
+	}
+	fd = epoll_create1(EPOLL_CLOEXEC);
+	if (FD_INVALID == fd)
+		ISSUE_SOCKWAIT_ERROR(errno);
+	dsocketptr->epoll_fd = fd;
+	dsocketptr->epoll_pid = pid;
+	dsocketptr->epoll_active = TRUE;
+}
+
+/* Make the registration of "socketptr" match "events" (a mask of EPOLLIN/EPOLLOUT). A zero mask removes the socket. */
+void iosocket_epoll_register(d_socket_struct *dsocketptr, socket_struct *socketptr, uint4 events)
+{
+	struct epoll_event	ev;
+	int			op, rc, save_errno;
+
+	if (0 == events)
+	{
+		IOSOCKET_EPOLL_UNREGISTER(dsocketptr, socketptr);
+		return;
+	}
+	iosocket_epoll_init(dsocketptr);
+	if (events == socketptr->epoll_events)
+		return;		/* Registration already current; the common case once a device is in steady state */
+	memset(&ev, 0, SIZEOF(ev));
+	ev.events = events;
+	ev.data.ptr = socketptr;
+	op = (0 == socketptr->epoll_events) ? EPOLL_CTL_ADD : EPOLL_CTL_MOD;
+	rc = epoll_ctl(dsocketptr->epoll_fd, op, socketptr->sd, &ev);
+	if (-1 == rc)
+	{	/* Our view of the registration can be stale if the descriptor was recycled; retry with the other operation */
+		save_errno = errno;
+		if ((EEXIST == save_errno) || (ENOENT == save_errno))
+		{
+			op = (EPOLL_CTL_ADD == op) ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+			rc = epoll_ctl(dsocketptr->epoll_fd, op, socketptr->sd, &ev);
+			save_errno = errno;
+		}
+		if (-1 == rc)
+		{
+			socketptr->epoll_events = 0;
+			ISSUE_SOCKWAIT_ERROR(save_errno);
+		}
+	}
+	socketptr->epoll_events = events;
+}
+
+/* Remove "socketptr" from the epoll set. Errors are ignored as the caller is about to close or hand off the descriptor.
+ * A process that inherited the instance across a fork() must not modify it as the interest list is shared with the parent.
+ */
+void iosocket_epoll_unregister(d_socket_struct *dsocketptr, socket_struct *socketptr)
+{
+	struct epoll_event	ev;
+
+	if (dsocketptr->epoll_active && (getpid() == dsocketptr->epoll_pid) && (FD_INVALID != socketptr->sd))
+		epoll_ctl(dsocketptr->epoll_fd, EPOLL_CTL_DEL, socketptr->sd, &ev);	/* ev needed by pre-2.6.9 kernels */
+	socketptr->epoll_events = 0;
+}
+
+/* Release the epoll instance once the device has no more sockets */
+void iosocket_epoll_close(d_socket_struct *dsocketptr)
+{
+	int	rc;
+
+	if (!dsocketptr->epoll_active)
+		return;
+	CLOSEFILE(dsocketptr->epoll_fd, rc);
+	dsocketptr->epoll_fd = FD_INVALID;
+	dsocketptr->epoll_active = FALSE;
+}
+
+/* Wait for up to "maxevents" ready sockets and return them in the same form poll() would have, i.e. "poll_fds[i].revents"
+ * and "poll_socketptr[i]" describe the i-th ready socket, so iosocket_wait() can process either result identically.
+ * Returns the number of ready sockets, 0 on timeout or -1 with errno set (in particular EINTR) like poll().
+ */
+int iosocket_epoll_wait(d_socket_struct *dsocketptr, struct epoll_event *events, int maxevents, int timeout,
+			struct pollfd *poll_fds, socket_struct **poll_socketptr)
+{
+	int		ii, rv;
+	socket_struct	*socketptr;
+
+	assert(dsocketptr->epoll_active && (0 < maxevents));
+	rv = epoll_wait(dsocketptr->epoll_fd, events, maxevents, timeout);
+	for (ii = 0; ii < rv; ii++)
+	{
+		socketptr = (socket_struct *)events[ii].data.ptr;
+		poll_socketptr[ii] = socketptr;
+		poll_fds[ii].fd = socketptr->sd;
+		poll_fds[ii].events = 0;
+		poll_fds[ii].revents = ((EPOLLIN & events[ii].events) ? POLLIN : 0)
+					| ((EPOLLOUT & events[ii].events) ? POLLOUT : 0)
+					| ((EPOLLERR & events[ii].events) ? POLLERR : 0)
+					| ((EPOLLHUP & events[ii].events) ? POLLHUP : 0);
+	}
+	return rv;
+}
@@ -0,0 +1,42 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+#ifndef IOSOCKET_EPOLL_H_INCLUDED
+#define IOSOCKET_EPOLL_H_INCLUDED
+
+#include <sys/epoll.h>
+#include "gtm_poll.h"
+
+/* WRITE /WAIT on a SOCKET device with at least $ydb_socket_epoll_threshold sockets (0, the default, disables this)
+ * uses an epoll instance owned by the device instead of rebuilding a poll() array on every call. Registrations
+ * persist across calls and are only modified (epoll_ctl) when the set of events a socket is waited for changes,
+ * so the kernel cost of a WAIT is proportional to the number of ready sockets rather than to the number of sockets.
+ * Level-triggered mode is used since an M READ need not drain everything the kernel has buffered for a socket.
+ */
+
+/* Remove a socket from the device epoll set. Needs to be done before the socket is closed or moved to another device */
+#define IOSOCKET_EPOLL_UNREGISTER(DSOCKETPTR, SOCKETPTR)		\
+MBSTART {								\
+	if (0 != (SOCKETPTR)->epoll_events)				\
+		iosocket_epoll_unregister(DSOCKETPTR, SOCKETPTR);	\
+} MBEND
+
+#define IOSOCKET_USE_EPOLL(DSOCKETPTR, WHICH_SOCKETPTR)								\
+	((NULL == (WHICH_SOCKETPTR)) && (0 < TREF(ydb_socket_epoll_threshold))					\
+		&& (TREF(ydb_socket_epoll_threshold) <= (DSOCKETPTR)->n_socket))
+
+void	iosocket_epoll_register(d_socket_struct *dsocketptr, socket_struct *socketptr, uint4 events);
+void	iosocket_epoll_unregister(d_socket_struct *dsocketptr, socket_struct *socketptr);
+void	iosocket_epoll_close(d_socket_struct *dsocketptr);
+int	iosocket_epoll_wait(d_socket_struct *dsocketptr, struct epoll_event *events, int maxevents, int timeout,
+			struct pollfd *poll_fds, socket_struct **poll_socketptr);
+
+#endif
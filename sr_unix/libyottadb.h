@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2017 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2024 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -407,6 +407,8 @@ int	ydb_data_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *s
 int	ydb_delete_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray, int deltype);
 int	ydb_delete_excl_s(int namecount, const ydb_buffer_t *varnames);
 int	ydb_get_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray, ydb_buffer_t *ret_value);
+int	ydb_get_multi_s(int count, const ydb_buffer_t *varnames, const int *subs_used, const ydb_buffer_t *const *subsarrays,
+			ydb_buffer_t *ret_values, int *ret_status);
 int	ydb_incr_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray, const ydb_buffer_t *increment, ydb_buffer_t *ret_value);
 int	ydb_lock_s(unsigned long long timeout_nsec, int namecount, ...);
 	/* ... above translates to one or more sets of [ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray] */
@@ -414,9 +416,13 @@ int	ydb_lock_decr_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer
 int	ydb_lock_incr_s(unsigned long long timeout_nsec, const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray);
 int	ydb_node_next_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray, int *ret_subs_used,
 			ydb_buffer_t *ret_subsarray);
+int	ydb_node_next_multi_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray, int max_nodes,
+			int *ret_count, int *ret_subs_used, ydb_buffer_t *const *ret_subsarrays, ydb_buffer_t *ret_values);
 int	ydb_node_previous_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray, int *ret_subs_used,
 			ydb_buffer_t *ret_subsarray);
 int	ydb_set_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray, const ydb_buffer_t *value);
+int	ydb_set_multi_s(int count, const ydb_buffer_t *varnames, const int *subs_used, const ydb_buffer_t *const *subsarrays,
+			const ydb_buffer_t *values, int *ret_status);
 int	ydb_str2zwr_s(const ydb_buffer_t *str, ydb_buffer_t *zwr);
 int	ydb_subscript_next_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray, ydb_buffer_t *ret_value);
 int	ydb_subscript_previous_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray, ydb_buffer_t *ret_value);
@@ -433,6 +439,8 @@ int	ydb_delete_st(uint64_t tptoken, ydb_buffer_t *errstr, const ydb_buffer_t *va
 int	ydb_delete_excl_st(uint64_t tptoken, ydb_buffer_t *errstr, int namecount, const ydb_buffer_t *varnames);
 int	ydb_get_st(uint64_t tptoken, ydb_buffer_t *errstr, const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray,
 			ydb_buffer_t *ret_value);
+int	ydb_get_multi_st(uint64_t tptoken, ydb_buffer_t *errstr, int count, const ydb_buffer_t *varnames, const int *subs_used,
+			const ydb_buffer_t *const *subsarrays, ydb_buffer_t *ret_values, int *ret_status);
 int	ydb_incr_st(uint64_t tptoken, ydb_buffer_t *errstr, const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray,
 			const ydb_buffer_t *increment, ydb_buffer_t *ret_value);
 int	ydb_lock_st(uint64_t tptoken, ydb_buffer_t *errstr, unsigned long long timeout_nsec, int namecount, ...);
@@ -442,10 +450,15 @@ int	ydb_lock_incr_st(uint64_t tptoken, ydb_buffer_t *errstr, unsigned long long
 			int subs_used, const ydb_buffer_t *subsarray);
 int	ydb_node_next_st(uint64_t tptoken, ydb_buffer_t *errstr, const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray,
 			int *ret_subs_used, ydb_buffer_t *ret_subsarray);
+int	ydb_node_next_multi_st(uint64_t tptoken, ydb_buffer_t *errstr, const ydb_buffer_t *varname, int subs_used,
+			const ydb_buffer_t *subsarray, int max_nodes, int *ret_count, int *ret_subs_used,
+			ydb_buffer_t *const *ret_subsarrays, ydb_buffer_t *ret_values);
 int	ydb_node_previous_st(uint64_t tptoken, ydb_buffer_t *errstr, const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray,
 			int *ret_subs_used, ydb_buffer_t *ret_subsarray);
 int	ydb_set_st(uint64_t tptoken, ydb_buffer_t *errstr, const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray,
 			const ydb_buffer_t *value);
+int	ydb_set_multi_st(uint64_t tptoken, ydb_buffer_t *errstr, int count, const ydb_buffer_t *varnames, const int *subs_used,
+			const ydb_buffer_t *const *subsarrays, const ydb_buffer_t *values, int *ret_status);
 int	ydb_str2zwr_st(uint64_t tptoken, ydb_buffer_t *errstr, const ydb_buffer_t *str, ydb_buffer_t *zwr);
 int	ydb_subscript_next_st(uint64_t tptoken, ydb_buffer_t *errstr, const ydb_buffer_t *varname, int subs_used,
 			const ydb_buffer_t *subsarray, ydb_buffer_t *ret_value);
@@ -1,6 +1,6 @@
 /****************************************************************
  *								*
- * Copyright (c) 2018-2020 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -28,13 +28,16 @@ LYDBRTN(LYDB_RTN_DATA, 			"ydb_data_s()",				"ydb_data_st()"				),	/* "ydb_data_
 LYDBRTN(LYDB_RTN_DELETE_EXCL, 		"ydb_delete_excl_s()",			"ydb_delete_excl_st()"			),	/* "ydb_delete_excl_s" is running */
 LYDBRTN(LYDB_RTN_DELETE, 		"ydb_delete_s()",			"ydb_delete_st()"			),	/* "ydb_delete_s" is running */
 LYDBRTN(LYDB_RTN_GET, 			"ydb_get_s()",				"ydb_get_st()"				),	/* "ydb_get_s" is running */
+LYDBRTN(LYDB_RTN_GET_MULTI, 		"ydb_get_multi_s()",			"ydb_get_multi_st()"			),	/* "ydb_get_multi_s" is running */
 LYDBRTN(LYDB_RTN_INCR,			"ydb_incr_s()",				"ydb_incr_st()"				),	/* "ydb_incr_s" is running */
 LYDBRTN(LYDB_RTN_LOCK, 			"ydb_lock_s()",				"ydb_lock_st()"				),	/* "ydb_lock_s" is running */
 LYDBRTN(LYDB_RTN_LOCK_DECR, 		"ydb_lock_decr_s()",			"ydb_lock_decr_st()"			),	/* "ydb_lock_decr_s" is running */
 LYDBRTN(LYDB_RTN_LOCK_INCR, 		"ydb_lock_incr_s()",			"ydb_lock_incr_st()"			),	/* "ydb_lock_incr_s" is running */
 LYDBRTN(LYDB_RTN_NODE_NEXT, 		"ydb_node_next_s()",			"ydb_node_next_st()"			),	/* "ydb_node_next_s" is running */
+LYDBRTN(LYDB_RTN_NODE_NEXT_MULTI, 	"ydb_node_next_multi_s()",		"ydb_node_next_multi_st()"		),	/* "ydb_node_next_multi_s" is running */
 LYDBRTN(LYDB_RTN_NODE_PREVIOUS, 	"ydb_node_previous_s()",		"ydb_node_previous_st()"		),	/* "ydb_node_previous_s" is running */
 LYDBRTN(LYDB_RTN_SET, 			"ydb_set_s()",				"ydb_set_st()"				),	/* "ydb_set_s" is running */
+LYDBRTN(LYDB_RTN_SET_MULTI, 		"ydb_set_multi_s()",			"ydb_set_multi_st()"			),	/* "ydb_set_multi_s" is running */
 LYDBRTN(LYDB_RTN_STR2ZWR,		"ydb_str2zwr_s()",			"ydb_str2zwr_st()"			),	/* "ydb_str2zwr_s" is running */
 LYDBRTN(LYDB_RTN_SUBSCRIPT_NEXT, 	"ydb_subscript_next_s()",		"ydb_subscript_next_st()"		),	/* "ydb_subscript_next_s" is running */
 LYDBRTN(LYDB_RTN_SUBSCRIPT_PREVIOUS, 	"ydb_subscript_previous_s()",		"ydb_subscript_previous_st()"		),	/* "ydb_subscript_previous_s" is running */
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2021 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2018-2025 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2018-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -32,6 +32,7 @@
 
 #include <errno.h>
 #include <sys/wait.h>
+#include <spawn.h>
 
 #if defined(SYS_ERRLIST_INCLUDE) && !defined(__CYGWIN__)
 #include SYS_ERRLIST_INCLUDE
@@ -153,33 +154,22 @@ error_def(ERR_YDBDISTUNVERIF);
 
 STATICFNDCL int io_rename(job_params_msg *params, const int jobid);
 
-/* Middle process sets the entryref for the jobbed-off process by calling job_addr(). job_addr() internally calls op_zlink(). If
- * rts_error occurs when we are in the job_addr() function, the topmost condition handler inherited from parent process will be
- * executed. That condition handler might not be adequate to handle the rts_error happened in the context of middle process.
- * Hence middle process is provided with its own condition handler.
+/* The topmost condition handler inherited from the parent process might not be adequate to handle an rts_error in the context of
+ * the middle process. Hence middle process is provided with its own condition handler, which reports the failure to the parent.
  */
 static CONDITION_HANDLER(middle_child)
 {
 	int pipe_status;
 
 	START_CH(FALSE);
-	/* As of now, middle process could encounter rts_error only while setting entryref. Hence the following assert.
-	 * Do assert after write to prevent parent hang.
-	 */
-	assert(joberr == joberr_rtn);
 	DOWRITERC(pipe_fd, &job_errno, SIZEOF(job_errno), pipe_status);
+	/* As of now, middle process could encounter rts_error only while cleaning up the I/O state the Job should not inherit
+	 * (the entryref is set by the Job itself). Do assert after write to prevent parent hang.
+	 */
+	assert(joberr_gen == joberr);
 	UNDERSCORE_EXIT(joberr);
 }
 
-/* Following condition handles the rts_error occurred in the grandchild before doing execv(). Since we have not started executing
- * M-cmd specified as a part of JOB command, it is enough to print the error and exit.
- */
-static CONDITION_HANDLER(grand_child)
-{
-	PRN_ERROR;
-	UNDERSCORE_EXIT(EXIT_SUCCESS);
-}
-
 /* Clean up zwrite state if it threw an error in ojpassvar_hook() */
 static CONDITION_HANDLER(ojlvzwr_ch)
 {
@@ -332,8 +322,8 @@ void local_variable_marshalling(FILE *setup_file_orig)
 }
 
 /* --------------------------------------------------------------------------------------------------------------------------------
- * The current process (P) FORKs a middle child process (M) that tests various job parameters. It then forks off the actual Job (J)
- * and exits, culminating the parent's (P) wait. The Job process (J) sets up its env and execs mumps.
+ * The current process (P) FORKs a middle child process (M) that tests various job parameters and sets up the env of the actual
+ * Job (J). It then spawns J (which execs mumps), sends J its setup information and exits, culminating the parent's (P) wait.
  *
  * Arguments
  * 	First argument is a pointer to the structure holding Job parameter values.
@@ -364,10 +354,8 @@ int ojstartchild (job_params_type *jparms, int argcnt, boolean_t *non_exit_retur
 	pid_t			done_pid;
 	job_parm		*jp;
 	rhdtyp			*rtnhdr;
-	struct sigaction	act, old_act;
+	struct sigaction	act;
 	int			pipe_status, env_len;
-	int			mproc_fds[2]; 	/* pipe between middle process and grandchild process */
-	int			decision;
 	job_setup_op		setup_op;
 	job_params_msg		params;
 	job_arg_count_msg	arg_count;
@@ -399,7 +387,7 @@ int ojstartchild (job_params_type *jparms, int argcnt, boolean_t *non_exit_retur
 		 * much hitch. If any error occurs during this, exit with appropriate status so the waiting parent can diagnose.
 		 */
 		getjobnum();	/* set "process_id" to a value different from parent */
-		skip_exit_handler = TRUE; /* The grandchild and the middle child should never execute gtm_exit_handler() */
+		skip_exit_handler = TRUE; /* The middle child should never execute gtm_exit_handler() */
 		/* set to TRUE so any child process associated with a pipe device will know it is not the parent in iorm_close() */
 		gtm_pipe_child = TRUE;
 		joberr = joberr_gen;
@@ -413,16 +401,7 @@ int ojstartchild (job_params_type *jparms, int argcnt, boolean_t *non_exit_retur
 		 */
 		act.sa_flags = YDB_SIGACTION_FLAGS;
 		act.sa_sigaction = job_term_handler;
-		sigaction(SIGTERM, &act, &old_act);
-		OPEN_PIPE(mproc_fds, pipe_status);
-		if (-1 == pipe_status)
-		{
-			joberr = joberr_pipe_mgc;
-			job_errno = errno;
-			DOWRITERC(pipe_fds[1], &job_errno, SIZEOF(job_errno), pipe_status);
-			assert(FALSE);
-			UNDERSCORE_EXIT(joberr);
-		}
+		sigaction(SIGTERM, &act, NULL);
 		if (!IS_JOB_SOCKET(jparms->params.input.buffer, jparms->params.input.len))
 		{
 			assert(MAX_STDIOE_LEN > jparms->params.input.len);
@@ -517,200 +496,46 @@ int ojstartchild (job_params_type *jparms, int argcnt, boolean_t *non_exit_retur
 			UNDERSCORE_EXIT(joberr);
 		}
 		assert(!WBTEST_ENABLED(WBTEST_JOBFAIL_FILE_LIM));
-		/* Kill ourselves before we fork again */
+		/* Kill ourselves before we spawn the Job */
 		if (WBTEST_ENABLED(WBTEST_SIGTERM_IN_JOB_CHILD))
 			kill(getpid(), SIGTERM);
-		/* clone self and exit */
-		joberr = joberr_frk;
-		FORK(child_pid);
-		if (0 > child_pid)
+		/* Everything the Job process (J) needs is set up here in the middle process and J is then started with
+		 * "posix_spawnp()" instead of a "fork()" followed by an "execvpe()" in the child. The middle process is a
+		 * copy of the (possibly large) parent process so a second "fork()" would copy all its page tables only for
+		 * J to discard them right away with the exec. "posix_spawnp()" shares the address space with the middle
+		 * process until the exec happens. The middle process exits right after sending the setup information
+		 * so it does not need anything that is cleaned up below.
+		 *
+		 * The grandchild used to set the dbg-only TREF(fork_without_child_wait) here as it went off independently of
+		 * the middle process once they were done with their pipe handshake. There is no grandchild fork any more:
+		 * J starts from a fresh image (so a variable set here is not seen by J) and the middle process leaves with
+		 * "_exit()" (so it never does a "relinkctl_rundown(TRUE,...)"). So the variable is not set.
+		 */
+		/* Run down any open flat files to reclaim their file descriptors */
+		joberr = joberr_gen;	/* for "middle_child" if this errors out */
+		io_rundown(RUNDOWN_EXCEPT_STD);
+		/* The Job should not inherit the read end of the pipe opened by grand parent (P), the write end which the middle
+		 * process still needs to report the Job's pid or the middle process end of the setup socket.
+		 */
+		FCNTL3(pipe_fds[0], F_SETFD, FD_CLOEXEC, rc);
+		if (-1 != rc)
+			FCNTL3(pipe_fds[1], F_SETFD, FD_CLOEXEC, rc);
+		if (-1 != rc)
+			FCNTL3(setup_fds[0], F_SETFD, FD_CLOEXEC, rc);
+		if (-1 == rc)
 		{
+			joberr = joberr_gen;
 			job_errno = errno;
 			DOWRITERC(pipe_fds[1], &job_errno, SIZEOF(job_errno), pipe_status);
 			assert(FALSE);
 			UNDERSCORE_EXIT(joberr);
 		}
-		if (child_pid)
-		{
-			/* This is still the middle process.  */
-			/* Close the read end of the pipe between middle process and grandchild process. */
-			CLOSEFILE_RESET(mproc_fds[0], pipe_status);	/* resets "mproc_fds[0]" to FD_INVALID */
-			CLOSEFILE_RESET(setup_fds[1], pipe_status);	/* resets "setup_fds[1]" to FD_INVALID */
-			assert(SIZEOF(pid_t) == SIZEOF(child_pid));
-			/* params data for 'output' and 'error' is populated here because io_rename() needs it in case appending of
-			 * JOB ID to Standard Output and Standard Error is required.
-			 */
-			params.output.len = jparms->params.output.len;
-			memcpy(params.output.buffer, jparms->params.output.buffer, jparms->params.output.len);
-			params.output.buffer[jparms->params.output.len] = '\0';
-			params.error.len = jparms->params.error.len;
-			memcpy(params.error.buffer, jparms->params.error.buffer, jparms->params.error.len);
-			params.error.buffer[jparms->params.error.len] = '\0';
-			/* if the Job pid need to be appended to the std out/err file names */
-			if (jobpid)
-			{
-				joberr = io_rename(&params, child_pid);
-				if (joberr)
-				{
-					/* Inform grandchild that it will have to exit. If pipe operation failed terminate
-					 * the grandchild.
-					 */
-					decision = JOB_EXIT;
-					DOWRITERC(mproc_fds[1], &decision, SIZEOF(decision), pipe_status);
-					if (pipe_status)
-						kill(child_pid, SIGTERM);
-					DOWRITERC(pipe_fds[1], &job_errno, SIZEOF(job_errno), pipe_status);
-					assert(FALSE);
-					UNDERSCORE_EXIT(joberr);
-				}
-			}
-			/* Inform grandchild that everything is properly set for it and it is ready to continue. */
-			decision = JOB_CONTINUE;
-			DOWRITERC(mproc_fds[1], &decision, SIZEOF(decision), pipe_status);
-			if (pipe_status)
-			{
-				kill(child_pid, SIGTERM);
-				joberr = joberr_pipe_mgc;
-				job_errno = errno;
-				DOWRITERC(pipe_fds[1], &job_errno, SIZEOF(job_errno), pipe_status);
-				assert(FALSE);
-				UNDERSCORE_EXIT(joberr);
-			}
-			/* send job parameters and arguments to final mumps process over setup socket */
-			setup_op = job_set_params;
-			SEND(setup_fds[0], &setup_op, SIZEOF(setup_op), 0, rc);
-			if (rc < 0)
-				SETUP_OP_FAIL();
-			SEND(setup_fds[0], &jparms->params, SIZEOF(jparms->params), 0, rc);
-			if (rc < 0)
-				SETUP_DATA_FAIL();
-			/* Read status to catch any basic errors */
-			DOREADRC(setup_fds[0], &joberr, SIZEOF(joberr), rc);
-			if (rc < 0)
-			{
-				joberr = joberr_rtn;	/* Assume routine error if there is a problem getting the report */
-				job_errno = errno;
-			}
-			if (joberr_ok != joberr)
-			{
-				DOWRITERC(pipe_fds[1], &job_errno, SIZEOF(job_errno), pipe_status);
-				UNDERSCORE_EXIT(joberr);
-			}
-			setup_op = job_set_parm_list;
-			SEND(setup_fds[0], &setup_op, SIZEOF(setup_op), 0, rc);
-			if (rc < 0)
-				SETUP_OP_FAIL();
-			arg_count = argcnt;
-			SEND(setup_fds[0], &arg_count, SIZEOF(arg_count), 0, rc);
-			if (rc < 0)
-				SETUP_DATA_FAIL();
-			for (jp = jparms->parms;  jp ; jp = jp->next)
-			{
-				if (jp->parm->str.len > MAX_JOB_LEN)
-				{
-					kill(child_pid, SIGTERM);
-					joberr = joberr_io_setup_write;
-					job_errno = ERR_JOBPARTOOLONG;
-					DOWRITERC(pipe_fds[1], &job_errno, SIZEOF(job_errno), pipe_status);
-					assert(FALSE);
-					UNDERSCORE_EXIT(joberr);
-				}
-				if (0 == jp->parm->mvtype)
-					arg_msg.len = -1;	/* negative len indicates null arg */
-				else
-				{
-					MV_FORCE_STR(jp->parm);
-					arg_msg.len = jp->parm->str.len;
-					memcpy(arg_msg.data, jp->parm->str.addr, jp->parm->str.len);
-				}
-				SEND(setup_fds[0], &arg_msg.len, SIZEOF(arg_msg.len), 0, rc);
-				if (rc < 0)
-					SETUP_DATA_FAIL();
-				if (arg_msg.len >= 0)
-				{
-					SEND(setup_fds[0], &arg_msg.data, arg_msg.len, 0, rc);
-					if (rc < 0)
-						SETUP_DATA_FAIL();
-				}
-			}
-			if (0 < jparms->input_prebuffer_size)
-			{
-				setup_op = job_set_input_buffer;
-				SEND(setup_fds[0], &setup_op, SIZEOF(setup_op), 0, rc);
-				if (rc < 0)
-					SETUP_OP_FAIL();
-				buffer_size = jparms->input_prebuffer_size;
-				SEND(setup_fds[0], &buffer_size, SIZEOF(buffer_size), 0, rc);
-				if (rc < 0)
-					SETUP_DATA_FAIL();
-				SEND(setup_fds[0], jparms->input_prebuffer, jparms->input_prebuffer_size, 0, rc);
-				if (rc < 0)
-					SETUP_DATA_FAIL();
-				/* input_prebuffer leaks, but the middle process is about to exit, so don't worry about it */
-			}
-			setup_op = job_done;
-			SEND(setup_fds[0], &setup_op, SIZEOF(setup_op), 0, rc);
-			if (rc < 0)
-				SETUP_OP_FAIL();
-			/* Send the local variables */
-			if (jparms->passcurlvn)
-			{
-				SEND(setup_fds[0], jparms->curlvn_buffer_ptr, jparms->curlvn_buffer_size, 0, rc);
-				system_free(jparms->curlvn_buffer_ptr);		/* Space allocated by open_memstream in ojparams */
-				if (rc < 0)
-					SETUP_OP_FAIL();
-			}
-			/* Tell job to proceed */
-			setup_op = local_trans_done;
-			SEND(setup_fds[0], &setup_op, SIZEOF(setup_op), 0, rc);
-			if (rc < 0)
-				SETUP_OP_FAIL();
-			/* Write child_pid into pipe to be read by parent process(P) for $ZJOB */
-			/* Ignore the status if this fails, as the child is already running, and there is likely not a parent
-			 * to report to.
-			 */
-			DOWRITERC(pipe_fds[1], &child_pid, SIZEOF(child_pid), pipe_status);
-			UNDERSCORE_EXIT(EXIT_SUCCESS);
-		}
-		/* This is now the grandchild process (actual Job process) -- an orphan as soon as the EXIT(EXIT_SUCCESS) above
-		 * occurs. Revert the condition handler established by middle process and establish its own condition handler */
-		REVERT;
-		getjobnum();	/* set "process_id" to a value different from parent (middle child) */
-		ESTABLISH_RET(grand_child, 0);
-		sigaction(SIGTERM, &old_act, NULL);		/* restore the SIGTERM handler */
-		CLOSEFILE_RESET(setup_fds[0], pipe_status);	/* resets "setup_fds[0]" to FD_INVALID */
-		/* Since middle child and grand child go off independently, it is possible the grandchild executes
-		 * "relinkctl_rundown(TRUE,...)" a little before the middle child has done "relinkctl_rundown(FALSE,...)"
-		 * and this means the grand child could potentially find the GT.M nattached counter to be 0 but the shmctl
-		 * nattach counter could still be non-zero (because the middle child has not yet detached from relinkctl shm).
-		 * To avoid a related assert in "relinkctl_rundown" from failing, set dbg-only variable.
-		 */
-		DEBUG_ONLY(TREF(fork_without_child_wait) = TRUE);
-		DOREADRC(mproc_fds[0], &decision, SIZEOF(decision), pipe_status);
-		if (pipe_status)	 /* We failed to read the communication from middle process */
-		{
-			RTS_ERROR_CSA_ABT(NULL, VARLSTCNT(7) ERR_JOBFAIL, 0, ERR_TEXT, 2,
-				LEN_AND_LIT("Error reading from pipe"), errno);
-		} else
-		{
-			if (JOB_EXIT == decision)
-				EXIT(EXIT_SUCCESS);
-			assert(JOB_CONTINUE == decision);
-		}
-		CLOSEFILE_RESET(mproc_fds[0], pipe_status);	/* resets "mproc_fds[0]" to FD_INVALID */
-		CLOSEFILE_RESET(mproc_fds[1], pipe_status);	/* resets "mproc_fds[1]" to FD_INVALID */
-		/* Run down any open flat files to reclaim their file descriptors */
-		io_rundown(RUNDOWN_EXCEPT_STD);
-
-		/* release the pipe opened by grand parent (P) */
-		CLOSEFILE_RESET(pipe_fds[0], pipe_status);	/* resets "pipe_fds[0]" to FD_INVALID */
-		CLOSEFILE_RESET(pipe_fds[1], pipe_status);	/* resets "pipe_fds[1]" to FD_INVALID */
 
 		/* Count the number of environment variables.  */
 		for (environ_count = 0, c3 = environ, c2 = *c3;  c2;  c3++, c2 = *c3)
 			environ_count++;
 
-		/* the environment array passed to the grandchild is constructed by prefixing the job related environment
+		/* the environment array passed to the Job is constructed by prefixing the job related environment
 		 * variables ahead of the current environment (pointed to by the "environ" variable)
 		 *
 		 * e.g. if the current environment has only two environment variables env1=one and env2=two,
@@ -742,8 +567,11 @@ int ojstartchild (job_params_type *jparms, int argcnt, boolean_t *non_exit_retur
 
 		string_len = STRLEN("%s=%d") + STRLEN(CHILD_FLAG_ENV) + MAX_NUM_LEN - 4;
 		if (string_len >= MAX_YOTTADB_EXE_PATH_LEN)
-		{
-			RTS_ERROR_CSA_ABT(NULL, VARLSTCNT(1) ERR_JOBPARTOOLONG);
+		{	/* Reported through the pipe as "middle_child" only expects errors from setting the entryref */
+			joberr = joberr_io_setup_write;
+			job_errno = ERR_JOBPARTOOLONG;
+			DOWRITERC(pipe_fds[1], &job_errno, SIZEOF(job_errno), pipe_status);
+			UNDERSCORE_EXIT(joberr);
 		}
 		c1 = (char *)malloc(string_len + 1);
 #ifdef KEEP_zOS_EBCDIC
@@ -754,7 +582,7 @@ int ojstartchild (job_params_type *jparms, int argcnt, boolean_t *non_exit_retur
 #pragma convlit(resume)
 #endif
 		/* Pass all information about the job via shell's environment.
-		 * The grandchild will get those variables to obtain the info about the job.
+		 * The Job will get those variables to obtain the info about the job.
 		 */
 
 		/* pass global directory to child */
@@ -777,7 +605,7 @@ int ojstartchild (job_params_type *jparms, int argcnt, boolean_t *non_exit_retur
 		/* before appending the old environment into the environment array, do not add those
 		 * lines that correspond to any of the above already initialized environment variables.
 		 * this prevents indefinite growing of the environment array with nesting of job commands
-		 * which otherwise would show up eventually as an "Arg list too long" error from EXECVE() below.
+		 * which otherwise would show up eventually as an "Arg list too long" error from "posix_spawnp()" below.
 		 */
 		new_env_top = env_ind;
 		old_env_top = &environ[environ_count];
@@ -805,7 +633,7 @@ int ojstartchild (job_params_type *jparms, int argcnt, boolean_t *non_exit_retur
 			}
 			*env_ind++ = *old_env_cur;
 		}
-		*env_ind = NULL;	/* null terminator required by execve() */
+		*env_ind = NULL;	/* null terminator required by posix_spawnp() */
 
 		c1 = ydb_dist;
 		string_len = STRLEN(c1);
@@ -853,8 +681,10 @@ int ojstartchild (job_params_type *jparms, int argcnt, boolean_t *non_exit_retur
 			 * This is impossible hence the below assert.
 			 */
 			assert(string_len);
-			RTS_ERROR_CSA_ABT(NULL, VARLSTCNT(5) ERR_LOGTOOLONG, 3, string_len, c1,
-				SIZEOF(tbuff) - strlen(exe_str));
+			joberr = joberr_gen;
+			job_errno = ERR_LOGTOOLONG;
+			DOWRITERC(pipe_fds[1], &job_errno, SIZEOF(job_errno), pipe_status);
+			UNDERSCORE_EXIT(joberr);
 		}
 #		ifdef KEEP_zOS_EBCDIC_	/* use real strcpy to preserve env in native code set */
 #		pragma convlit(suspend)
@@ -869,13 +699,17 @@ int ojstartchild (job_params_type *jparms, int argcnt, boolean_t *non_exit_retur
 		{
 			if (jparms->cmdline.len >= TEMP_BUFF_SIZE)
 			{
-				RTS_ERROR_CSA_ABT(NULL, VARLSTCNT(1) ERR_JOBPARTOOLONG);
+				joberr = joberr_io_setup_write;
+				job_errno = ERR_JOBPARTOOLONG;
+				DOWRITERC(pipe_fds[1], &job_errno, SIZEOF(job_errno), pipe_status);
+				UNDERSCORE_EXIT(joberr);
 			}
 			memcpy(cmdbuff, jparms->cmdline.buffer, jparms->cmdline.len);
 			*(cmdbuff + jparms->cmdline.len) = 0;
 		} else
 			memset(cmdbuff, 0, TEMP_BUFF_SIZE);
 		/* Do common cleanup in child. */
+		joberr = joberr_gen;	/* for "middle_child" if this errors out */
 		ojchildioclean();
 
 #ifdef KEEP_zOS_EBCDIC
@@ -887,18 +721,140 @@ int ojstartchild (job_params_type *jparms, int argcnt, boolean_t *non_exit_retur
 		argv[1] = cbuff;
 		argv[2] = cmdbuff;
 		argv[3] = (char *)0;
-		/* Ignore all SIGHUPs until sig_init() is called. On AIX we have seen SIGHUP from middlechild to grandchild */
+		/* Ignore all SIGHUPs until sig_init() is called in the Job. On AIX we have seen SIGHUP from middlechild to
+		 * the Job. The middle process does not care about SIGHUP either and the disposition is inherited across the exec.
+		 */
 		signal(SIGHUP, SIG_IGN);
-		/* Need EXECVPE (instead of EXECVE) since it is possible "tbuff" points to an executable without an
-		 * absolute path name and we need to search in $PATH for a matching directory.
+		/* Need "posix_spawnp()" (instead of "posix_spawn()") since it is possible "tbuff" points to an executable
+		 * without an absolute path name and we need to search in $PATH for a matching directory.
 		 */
-		EXECVPE(tbuff, argv, env_ary);
-		assert(FALSE);
-		/* if we got here, error starting the Job */
-		save_errno = errno;
-		SNPRINTF(tbuff2, SIZEOF(tbuff2), "Error from EXECVPE(\"%s\")", tbuff);
-		RTS_ERROR_CSA_ABT(NULL, VARLSTCNT(7) ERR_JOBFAIL, 0, ERR_TEXT, 2, LEN_AND_STR(tbuff2), save_errno);
-		REVERT;
+		joberr = joberr_frk;
+		rc = posix_spawnp(&child_pid, tbuff, NULL, NULL, argv, env_ary);
+		if (0 != rc)
+		{
+			job_errno = rc;
+			DOWRITERC(pipe_fds[1], &job_errno, SIZEOF(job_errno), pipe_status);
+			UNDERSCORE_EXIT(joberr);
+		}
+		/* This is still the middle process. */
+		CLOSEFILE_RESET(setup_fds[1], pipe_status);	/* resets "setup_fds[1]" to FD_INVALID */
+		assert(SIZEOF(pid_t) == SIZEOF(child_pid));
+		/* params data for 'output' and 'error' is populated here because io_rename() needs it in case appending of
+		 * JOB ID to Standard Output and Standard Error is required.
+		 */
+		params.output.len = jparms->params.output.len;
+		memcpy(params.output.buffer, jparms->params.output.buffer, jparms->params.output.len);
+		params.output.buffer[jparms->params.output.len] = '\0';
+		params.error.len = jparms->params.error.len;
+		memcpy(params.error.buffer, jparms->params.error.buffer, jparms->params.error.len);
+		params.error.buffer[jparms->params.error.len] = '\0';
+		/* if the Job pid need to be appended to the std out/err file names */
+		if (jobpid)
+		{
+			joberr = io_rename(&params, child_pid);
+			if (joberr)
+			{	/* The Job is waiting for its setup information and has not run any M code yet. Terminate it. */
+				kill(child_pid, SIGTERM);
+				DOWRITERC(pipe_fds[1], &job_errno, SIZEOF(job_errno), pipe_status);
+				assert(FALSE);
+				UNDERSCORE_EXIT(joberr);
+			}
+		}
+		/* send job parameters and arguments to final mumps process over setup socket */
+		setup_op = job_set_params;
+		SEND(setup_fds[0], &setup_op, SIZEOF(setup_op), 0, rc);
+		if (rc < 0)
+			SETUP_OP_FAIL();
+		SEND(setup_fds[0], &jparms->params, SIZEOF(jparms->params), 0, rc);
+		if (rc < 0)
+			SETUP_DATA_FAIL();
+		/* Read status to catch any basic errors */
+		DOREADRC(setup_fds[0], &joberr, SIZEOF(joberr), rc);
+		if (rc < 0)
+		{
+			joberr = joberr_rtn;	/* Assume routine error if there is a problem getting the report */
+			job_errno = errno;
+		}
+		if (joberr_ok != joberr)
+		{
+			DOWRITERC(pipe_fds[1], &job_errno, SIZEOF(job_errno), pipe_status);
+			UNDERSCORE_EXIT(joberr);
+		}
+		setup_op = job_set_parm_list;
+		SEND(setup_fds[0], &setup_op, SIZEOF(setup_op), 0, rc);
+		if (rc < 0)
+			SETUP_OP_FAIL();
+		arg_count = argcnt;
+		SEND(setup_fds[0], &arg_count, SIZEOF(arg_count), 0, rc);
+		if (rc < 0)
+			SETUP_DATA_FAIL();
+		for (jp = jparms->parms;  jp ; jp = jp->next)
+		{
+			if (jp->parm->str.len > MAX_JOB_LEN)
+			{
+				kill(child_pid, SIGTERM);
+				joberr = joberr_io_setup_write;
+				job_errno = ERR_JOBPARTOOLONG;
+				DOWRITERC(pipe_fds[1], &job_errno, SIZEOF(job_errno), pipe_status);
+				assert(FALSE);
+				UNDERSCORE_EXIT(joberr);
+			}
+			if (0 == jp->parm->mvtype)
+				arg_msg.len = -1;	/* negative len indicates null arg */
+			else
+			{
+				MV_FORCE_STR(jp->parm);
+				arg_msg.len = jp->parm->str.len;
+				memcpy(arg_msg.data, jp->parm->str.addr, jp->parm->str.len);
+			}
+			SEND(setup_fds[0], &arg_msg.len, SIZEOF(arg_msg.len), 0, rc);
+			if (rc < 0)
+				SETUP_DATA_FAIL();
+			if (arg_msg.len >= 0)
+			{
+				SEND(setup_fds[0], &arg_msg.data, arg_msg.len, 0, rc);
+				if (rc < 0)
+					SETUP_DATA_FAIL();
+			}
+		}
+		if (0 < jparms->input_prebuffer_size)
+		{
+			setup_op = job_set_input_buffer;
+			SEND(setup_fds[0], &setup_op, SIZEOF(setup_op), 0, rc);
+			if (rc < 0)
+				SETUP_OP_FAIL();
+			buffer_size = jparms->input_prebuffer_size;
+			SEND(setup_fds[0], &buffer_size, SIZEOF(buffer_size), 0, rc);
+			if (rc < 0)
+				SETUP_DATA_FAIL();
+			SEND(setup_fds[0], jparms->input_prebuffer, jparms->input_prebuffer_size, 0, rc);
+			if (rc < 0)
+				SETUP_DATA_FAIL();
+			/* input_prebuffer leaks, but the middle process is about to exit, so don't worry about it */
+		}
+		setup_op = job_done;
+		SEND(setup_fds[0], &setup_op, SIZEOF(setup_op), 0, rc);
+		if (rc < 0)
+			SETUP_OP_FAIL();
+		/* Send the local variables */
+		if (jparms->passcurlvn)
+		{
+			SEND(setup_fds[0], jparms->curlvn_buffer_ptr, jparms->curlvn_buffer_size, 0, rc);
+			system_free(jparms->curlvn_buffer_ptr);		/* Space allocated by open_memstream in ojparams */
+			if (rc < 0)
+				SETUP_OP_FAIL();
+		}
+		/* Tell job to proceed */
+		setup_op = local_trans_done;
+		SEND(setup_fds[0], &setup_op, SIZEOF(setup_op), 0, rc);
+		if (rc < 0)
+			SETUP_OP_FAIL();
+		/* Write child_pid into pipe to be read by parent process(P) for $ZJOB */
+		/* Ignore the status if this fails, as the child is already running, and there is likely not a parent
+		 * to report to.
+		 */
+		DOWRITERC(pipe_fds[1], &child_pid, SIZEOF(child_pid), pipe_status);
+		UNDERSCORE_EXIT(EXIT_SUCCESS);
 	} else
 	{
 		/* Parent, wait for the Middle process */
@@ -3,7 +3,7 @@
  * Copyright (c) 2014-2023 Fidelity National Information	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017-2025 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -28,6 +28,7 @@
 
 #include "add_inter.h"
 #include "interlock.h"
+#include "memcoherency.h"
 #include "gdsroot.h"
 #include "gdsbt.h"
 #include "gdsfhead.h"
@@ -919,6 +920,10 @@ relinkrec_t *relinkctl_find_record(open_relinkctl_sgm *linkctl, mstr *rtnname, u
 
 	assert(valid_mname(rtnname));
 	linkctl->n_records = linkctl->hdr->n_records;	/* Make sure we search among all currently existing records */
+	/* This search is done without the relinkctl lock. Pairs with the write barrier in "relinkctl_insert_record" so a
+	 * record whose index is below the "n_records" just read is seen fully initialized and linked into its hash chain.
+	 */
+	SHM_READ_MEMORY_BARRIER;
 	ptr = linkctl->shm_hashbase;
 	assert(linkctl->hdr->relinkctl_hash_buckets > hash);
 	ptr += hash;
@@ -986,6 +991,10 @@ relinkrec_t *relinkctl_insert_record(open_relinkctl_sgm *linkctl, mstr *rtnname)
 				base[prev_hash_index].hashindex_fl = nrec + 1;
 			} else
 				linkctl->shm_hashbase[hash] = nrec + 1;
+			/* Lock-free readers in "relinkctl_find_record" ignore any index at or beyond "n_records" so the record
+			 * and its hash chain link must be visible before the new count is.
+			 */
+			SHM_WRITE_MEMORY_BARRIER;
 			linkctl->hdr->n_records++;
 			assert(rec == relinkctl_find_record(linkctl, rtnname, hash, &prev_hash_index));
 		}
@@ -3,7 +3,7 @@
  * Copyright (c) 2001-2015 Fidelity National Information 	*
  * Services, Inc. and/or its subsidiaries. All rights reserved.	*
  *								*
- * Copyright (c) 2017 YottaDB LLC and/or its subsidiaries.	*
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries.	*
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -290,6 +290,7 @@ int get_src_line(mval *routine, mval *label, int offset, mstr **srcret, rhdtyp *
 void free_src_tbl(rhdtyp *rtn_vector);
 unsigned char *find_line_start(unsigned char *in_addr, rhdtyp *routine);
 int4 *find_line_addr(rhdtyp *routine, mstr *label, int4 offset, mident **lent_name);
+lab_tabent *find_lab_tabent(lab_tabent *base, lab_tabent *top, mident *name);
 rhdtyp *find_rtn_hdr(mstr *name);
 boolean_t find_rtn_tabent(rtn_tabent **res, mstr *name);
 bool zlput_rname(rhdtyp *hdr);
@@ -1,6 +1,6 @@
 /****************************************************************
  *								*
- * Copyright (c) 2017-2023 YottaDB LLC and/or its subsidiaries. *
+ * Copyright (c) 2017-2026 YottaDB LLC and/or its subsidiaries. *
  * All rights reserved.						*
  *								*
  *	This source code contains the intellectual property	*
@@ -34,7 +34,9 @@
 #include "deferred_events_queue.h"
 #include "min_max.h"
 #include "zshow.h"		/* needed for "format2zwr" prototype */
+#include "gvt_thread_clue.h"
 
+GBLREF	gv_namehead	*gv_target;
 GBLREF	volatile int4	outofband;
 
 LITREF mval		literal_null;
@@ -191,6 +193,7 @@ int ydb_get_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *su
 			COPY_PARMS_TO_CALLG_BUFFER(subs_used, subsarray, plist, plist_mvals, FALSE, 1,
 							LYDBRTNNAME(LYDB_RTN_GET));
 			callg((callgfnptr)op_gvname, &plist);		/* Drive "op_gvname" to create key */
+			GVT_THREAD_CLUE_SWITCH_IF_NEEDED(gv_target);	/* Pick up this thread's clue if another thread replaced it */
 			gotit = op_gvget(&get_value);			/* Fetch value into get_value - should signal UNDEF
 									 * if value not found (and undef_inhibit not set)
 									 */
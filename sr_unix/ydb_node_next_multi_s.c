@@ -0,0 +1,178 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+#include "mdef.h"
+
+#include "gtm_string.h"
+
+#include "lv_val.h"
+#include "hashtab_mname.h"
+#include "callg.h"
+#include "op.h"
+#include "error.h"
+#include "nametabtyp.h"
+#include "namelook.h"
+#include "stringpool.h"
+#include "libyottadb_int.h"
+#include "gdsroot.h"
+#include "gtm_facility.h"
+#include "fileinfo.h"
+#include "gdsbt.h"
+#include "gdsfhead.h"
+#include "deferred_events_queue.h"
+#include "gvt_thread_clue.h"
+
+GBLREF	gv_namehead	*gv_target;
+GBLREF	volatile int4	outofband;
+
+/* Routine to locate (and optionally fetch the values of) a batch of nodes following a given node of a global variable,
+ * i.e. a forward $query done repeatedly in one call.
+ *
+ * Parameters:
+ *   varname	    - Gives name of global variable
+ *   subs_used	    - Count of subscripts (if any else 0) in input node
+ *   subsarray	    - an array of "subs_used" subscripts in input node (not looked at if "subs_used" is 0)
+ *   max_nodes	    - Maximum number of nodes to return
+ *   ret_count	    - Count of nodes returned. Kept up to date as nodes are returned so it is valid even if an error is returned.
+ *   ret_subs_used  - Array of "max_nodes" ints. On input, each entry is the count of buffers allocated in the corresponding
+ *		      "ret_subsarrays" entry. On output, the count of subscripts in the corresponding returned node.
+ *   ret_subsarrays - Array of "max_nodes" subscript arrays that receive the subscripts of the returned nodes
+ *   ret_values	    - Array of "max_nodes" buffers that receive the values of the returned nodes (NULL if only the nodes
+ *		      are needed)
+ *
+ * Returns YDB_OK if "max_nodes" nodes were returned, YDB_ERR_NODEEND if the end of the global was reached (after returning
+ * "*ret_count" nodes, which could be 0) and otherwise an error code.
+ *
+ * To traverse a global, callers pass the last node returned by one call as the input node of the next call. Each node
+ * is located by "op_gvquery" with the key built from the previous node so the gv_target clue makes every search after
+ * the first one of a batch start from the leaf block of the previous node rather than from the root. A node that is found
+ * but gets killed by a concurrent update before its value can be fetched is skipped. Local variables are not supported.
+ */
+int ydb_node_next_multi_s(const ydb_buffer_t *varname, int subs_used, const ydb_buffer_t *subsarray, int max_nodes,
+			int *ret_count, int *ret_subs_used, ydb_buffer_t *const *ret_subsarrays, ydb_buffer_t *ret_values)
+{
+	boolean_t		error_encountered, key_built;
+	const ydb_buffer_t	*node_subs;
+	gparam_list		plist;
+	int			nodenext_svn_index, status, nodes, nsubs, subs_alloc;
+	mval			gvname, get_value, plist_mvals[YDB_MAX_SUBS + 1];
+	ydb_var_types		nodenext_type;
+	DCL_THREADGBL_ACCESS;
+
+	SETUP_THREADGBL_ACCESS;
+	VERIFY_NON_THREADED_API;	/* clears a global variable "caller_func_is_stapi" set by SimpleThreadAPI caller
+					 * so needs to be first invocation after SETUP_THREADGBL_ACCESS to avoid any error
+					 * scenarios from not resetting this global variable even though this function returns.
+					 */
+	/* Verify entry conditions, make sure YDB CI environment is up etc. */
+	LIBYOTTADB_INIT(LYDB_RTN_NODE_NEXT_MULTI, (int));	/* Note: macro could "return" from this function in case of errors */
+	assert(0 == TREF(sapi_mstrs_for_gc_indx));	/* previously unused entries should have been cleared by that
+							 * corresponding ydb_*_s() call.
+							 */
+	ESTABLISH_NORET(ydb_simpleapi_ch, error_encountered);
+	if (error_encountered)
+	{
+		assert(0 == TREF(sapi_query_node_subs_cnt));	/* should have been cleared by "ydb_simpleapi_ch" */
+		assert(0 == TREF(sapi_mstrs_for_gc_indx));	/* Should have been cleared by "ydb_simpleapi_ch" */
+		REVERT;
+		return ((ERR_TPRETRY == SIGNAL) ? YDB_TP_RESTART : -(TREF(ydb_error_code)));
+	}
+	/* Check if an outofband action that might care about has popped up */
+	if (outofband)
+		outofband_action(FALSE);
+	/* Do some validation */
+	VALIDATE_VARNAME(varname, subs_used, FALSE, LYDB_RTN_NODE_NEXT_MULTI, -1, nodenext_type, nodenext_svn_index);
+	if (LYDB_VARREF_GLOBAL != nodenext_type)
+		rts_error_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_PARAMINVALID, 4,
+			LEN_AND_LIT("varname is not a global variable name"), LEN_AND_STR(LYDBRTNNAME(LYDB_RTN_NODE_NEXT_MULTI)));
+	if (0 >= max_nodes)
+		rts_error_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_PARAMINVALID, 4,
+			LEN_AND_LIT("Non-positive max_nodes"), LEN_AND_STR(LYDBRTNNAME(LYDB_RTN_NODE_NEXT_MULTI)));
+	if (NULL == ret_count)
+		rts_error_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_PARAMINVALID, 4,
+			LEN_AND_LIT("NULL ret_count"), LEN_AND_STR(LYDBRTNNAME(LYDB_RTN_NODE_NEXT_MULTI)));
+	if (NULL == ret_subs_used)
+		rts_error_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_PARAMINVALID, 4,
+			LEN_AND_LIT("NULL ret_subs_used"), LEN_AND_STR(LYDBRTNNAME(LYDB_RTN_NODE_NEXT_MULTI)));
+	if (NULL == ret_subsarrays)
+		rts_error_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_PARAMINVALID, 4,
+			LEN_AND_LIT("NULL ret_subsarrays"), LEN_AND_STR(LYDBRTNNAME(LYDB_RTN_NODE_NEXT_MULTI)));
+	*ret_count = 0;
+	/* Same as the global variable case in "ydb_node_next_s" for the first node. Each later node starts from the key of
+	 * the node returned just before it, which is rebuilt from the subscripts already copied to the caller's buffers.
+	 */
+	gvname.mvtype = MV_STR;
+	gvname.str.addr = varname->buf_addr + 1;	/* Point past '^' to var name */
+	gvname.str.len = varname->len_used - 1;
+	nsubs = subs_used;
+	node_subs = subsarray;
+	key_built = FALSE;
+	status = YDB_OK;
+	for (nodes = 0; nodes < max_nodes; )
+	{	/* A big batch can take a while so check for an outofband action (e.g. a pending MUPIP STOP) before each node */
+		if (outofband)
+			outofband_action(FALSE);
+		if (!key_built)
+		{	/* Drive "op_gvname" to create the key of the node to start from */
+			if (0 < nsubs)
+			{
+				plist.arg[0] = &gvname;
+				COPY_PARMS_TO_CALLG_BUFFER(nsubs, node_subs, plist, plist_mvals, FALSE, 1,
+								LYDBRTNNAME(LYDB_RTN_NODE_NEXT_MULTI));
+				callg((callgfnptr)op_gvname, &plist);
+			} else
+				op_gvname(1, &gvname);
+			if (0 == nodes)
+				GVT_THREAD_CLUE_SWITCH_IF_NEEDED(gv_target);	/* Pick up this thread's clue if another thread
+										 * replaced it.
+										 */
+		}
+		op_gvquery(NULL);				/* Locate next node */
+		subs_alloc = ret_subs_used[nodes];		/* Note "sapi_return_subscr_nodes" overwrites this */
+		status = sapi_return_subscr_nodes(&ret_subs_used[nodes], ret_subsarrays[nodes],
+							(char *)LYDBRTNNAME(LYDB_RTN_NODE_NEXT_MULTI));
+		TREF(sapi_query_node_subs_cnt) = 0;
+		if (YDB_OK != status)
+			break;					/* YDB_ERR_NODEEND */
+		/* The next node is located starting from the one just found */
+		nsubs = ret_subs_used[nodes];
+		node_subs = ret_subsarrays[nodes];
+		key_built = FALSE;
+		if (NULL != ret_values)
+		{	/* Position on the node just found and fetch its value. The key stays as is for the next "op_gvquery". */
+			if (0 < nsubs)
+			{
+				plist.arg[0] = &gvname;
+				COPY_PARMS_TO_CALLG_BUFFER(nsubs, node_subs, plist, plist_mvals, FALSE, 1,
+								LYDBRTNNAME(LYDB_RTN_NODE_NEXT_MULTI));
+				callg((callgfnptr)op_gvname, &plist);
+			} else
+				op_gvname(1, &gvname);
+			key_built = TRUE;
+			op_fngvget1(&get_value);		/* Sets "mvtype" to 0 if the node is no longer defined */
+			if (0 == get_value.mvtype)
+			{	/* The node was killed by a concurrent update after "op_gvquery" found it. Skip it and locate
+				 * the next node into this same entry.
+				 */
+				ret_subs_used[nodes] = subs_alloc;
+				continue;
+			}
+			SET_YDB_BUFF_T_FROM_MVAL(&ret_values[nodes], &get_value, "NULL ret_values[].buf_addr",
+							LYDBRTNNAME(LYDB_RTN_NODE_NEXT_MULTI));
+		}
+		*ret_count = ++nodes;
+	}
+	assert(0 == TREF(sapi_mstrs_for_gc_indx));	/* the counter should have never become non-zero in this function */
+	LIBYOTTADB_DONE;
+	REVERT;
+	return status;
+}
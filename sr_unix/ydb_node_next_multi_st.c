@@ -0,0 +1,49 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+#include "mdef.h"
+
+#include "libyottadb_int.h"
+
+GBLREF	boolean_t	caller_func_is_stapi;
+
+/* Routine to drive ydb_node_next_multi_s() in a worker thread so YottaDB access is isolated. Note because this drives
+ * ydb_node_next_multi_s(), we don't do any of the exclusive access checks here. The thread management itself takes care of
+ * most of that currently but also the check in LIBYOTTADB_INIT*() macro will happen in ydb_node_next_multi_s() still so no
+ * need for it here. The one exception to this is that we need to make sure the run time is alive.
+ *
+ * Parms and return - same as ydb_node_next_multi_s() except for the addition of tptoken and errstr. The engine lock is
+ * obtained once for the whole batch rather than once per node as a loop of ydb_node_next_st()/ydb_get_st() calls would.
+ */
+int ydb_node_next_multi_st(uint64_t tptoken, ydb_buffer_t *errstr, const ydb_buffer_t *varname, int subs_used,
+		const ydb_buffer_t *subsarray, int max_nodes, int *ret_count, int *ret_subs_used,
+		ydb_buffer_t *const *ret_subsarrays, ydb_buffer_t *ret_values)
+{
+	libyottadb_routines	save_active_stapi_rtn;
+	ydb_buffer_t		*save_errstr;
+	boolean_t		get_lock;
+	int			retval;
+	DCL_THREADGBL_ACCESS;
+
+	LIBYOTTADB_RUNTIME_CHECK((int), errstr);	/* Note: Also does SETUP_THREADGBL_ACCESS; May return if error */
+	VERIFY_THREADED_API((int), errstr);
+	threaded_api_ydb_engine_lock(tptoken, errstr, LYDB_RTN_NODE_NEXT_MULTI, &save_active_stapi_rtn, &save_errstr, &get_lock,
+					&retval);
+	if (YDB_OK == retval)
+	{
+		caller_func_is_stapi = TRUE;	/* used to inform below SimpleAPI call that caller is SimpleThreadAPI */
+		retval = ydb_node_next_multi_s(varname, subs_used, subsarray, max_nodes, ret_count, ret_subs_used, ret_subsarrays,
+						ret_values);
+		threaded_api_ydb_engine_unlock(tptoken, errstr, save_active_stapi_rtn, save_errstr, get_lock);
+	}
+	return retval;
+}
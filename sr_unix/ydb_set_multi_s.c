@@ -0,0 +1,174 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+#include "mdef.h"
+
+#include "gtm_string.h"
+
+#undef DEBUG_LIBYOTTADB		/* Change to #define to enable debugging - must be set prior to include of libyottadb_int.h */
+
+#include "lv_val.h"
+#include "hashtab_mname.h"
+#include "callg.h"
+#include "op.h"
+#include "error.h"
+#include "nametabtyp.h"
+#include "namelook.h"
+#include "stringpool.h"
+#include "libyottadb_int.h"
+#include "deferred_events_queue.h"
+#include "min_max.h"
+#include "compiler.h"
+
+GBLREF	volatile int4	outofband;
+
+/* Routine to set the values of a batch of global variable nodes in one call
+ *
+ * Parameters:
+ *   count	- Number of nodes to set
+ *   varnames	- Array of "count" global variable names
+ *   subs_used	- Array of "count" subscript counts (NULL if no node has subscripts)
+ *   subsarrays	- Array of "count" subscript arrays (NULL if no node has subscripts; an entry is not looked at if the
+ *		  corresponding "subs_used" entry is 0)
+ *   values	- Array of "count" values to set (NULL sets all nodes to the null string)
+ *   ret_status	- Array of "count" ints that receive the per-node status (YDB_OK or a negated error code). If NULL, the
+ *		  call stops at the first node that gets an error.
+ *
+ * Returns YDB_OK if all nodes were set, YDB_TP_RESTART if a restart is needed (no further nodes are set) and
+ * otherwise the status of the first node that got an error. Outside of TP, each node is its own update so nodes
+ * set before an error stay set.
+ *
+ * See "ydb_get_multi_s" for why this is cheaper than a loop of "ydb_set_s" calls.
+ */
+int ydb_set_multi_s(int count, const ydb_buffer_t *varnames, const int *subs_used, const ydb_buffer_t *const *subsarrays,
+			const ydb_buffer_t *values, int *ret_status)
+{
+	boolean_t		error_encountered, node_error;
+	const ydb_buffer_t	*value, *varname, *prev_varname;
+	gparam_list		plist;
+	int			set_svn_index, hash_code, i, nsubs, retval, status;
+	mval			set_value, gvname, plist_mvals[YDB_MAX_SUBS + 1];
+	ydb_buffer_t		null_ydb_buff;
+	ydb_var_types		set_type;
+	DCL_THREADGBL_ACCESS;
+
+	SETUP_THREADGBL_ACCESS;
+	VERIFY_NON_THREADED_API;	/* clears a global variable "caller_func_is_stapi" set by SimpleThreadAPI caller
+					 * so needs to be first invocation after SETUP_THREADGBL_ACCESS to avoid any error
+					 * scenarios from not resetting this global variable even though this function returns.
+					 */
+	/* Verify entry conditions, make sure YDB CI environment is up etc. */
+	LIBYOTTADB_INIT(LYDB_RTN_SET_MULTI, (int));	/* Note: macro could "return" from this function in case of errors */
+	assert(0 == TREF(sapi_mstrs_for_gc_indx));	/* previously unused entries should have been cleared by that
+							 * corresponding ydb_*_s() call.
+							 */
+	ESTABLISH_NORET(ydb_simpleapi_ch, error_encountered);
+	if (error_encountered)
+	{
+		assert(0 == TREF(sapi_mstrs_for_gc_indx));	/* should have been cleared by "ydb_simpleapi_ch" */
+		REVERT;
+		return ((ERR_TPRETRY == SIGNAL) ? YDB_TP_RESTART : -(TREF(ydb_error_code)));
+	}
+	/* Check if an outofband action that might care about has popped up */
+	if (outofband)
+		outofband_action(FALSE);
+	/* Validate the batch as a whole. Errors in an individual node are reported through "ret_status" below. */
+	if (0 > count)
+		rts_error_csa(CSA_ARG(NULL) VARLSTCNT(4) ERR_INVNAMECOUNT, 2, LEN_AND_STR(LYDBRTNNAME(LYDB_RTN_SET_MULTI)));
+	if (count && (NULL == varnames))
+		rts_error_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_PARAMINVALID, 4,
+			LEN_AND_LIT("NULL varnames"), LEN_AND_STR(LYDBRTNNAME(LYDB_RTN_SET_MULTI)));
+	null_ydb_buff.len_used = 0;
+	null_ydb_buff.len_alloc = 0;
+	null_ydb_buff.buf_addr = NULL;
+	retval = YDB_OK;
+	prev_varname = NULL;
+	hash_code = 0;
+	for (i = 0; i < count; i++)
+	{	/* A big batch can take a while so check for an outofband action (e.g. a pending MUPIP STOP) before each node.
+		 * This is done before the per-node condition handler is established so an error from it ends the batch.
+		 */
+		if (outofband)
+			outofband_action(FALSE);
+		ESTABLISH_NORET(ydb_simpleapi_ch, node_error);
+		if (node_error)
+		{	/* "ydb_simpleapi_ch" did a LIBYOTTADB_DONE and unwound back here. A TPRETRY ends the batch since the
+			 * restart has already been done. Any other error is recorded against this node and we move on.
+			 */
+			assert(0 == TREF(sapi_mstrs_for_gc_indx));
+			REVERT;
+			if (ERR_TPRETRY == SIGNAL)
+			{
+				REVERT;
+				return YDB_TP_RESTART;
+			}
+			status = -(TREF(ydb_error_code));
+			if (YDB_OK == retval)
+				retval = status;
+			if (NULL == ret_status)
+				break;
+			ret_status[i] = status;
+			TREF(libyottadb_active_rtn) = LYDB_RTN_SET_MULTI;
+			prev_varname = NULL;	/* Not safe to assume "hash_code" is in sync after a longjmp */
+			continue;
+		}
+		varname = &varnames[i];
+		nsubs = (NULL == subs_used) ? 0 : subs_used[i];
+		VALIDATE_VARNAME(varname, nsubs, TRUE, LYDB_RTN_SET_MULTI, -1, set_type, set_svn_index);
+		if (LYDB_VARREF_GLOBAL != set_type)
+		{
+			char	buff[256];		/* snprintf() buffer */
+
+			SNPRINTF(buff, SIZEOF(buff), "varname array (index %d) is not a global variable name", i);
+			rts_error_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_PARAMINVALID, 4,
+				LEN_AND_STR(buff), LEN_AND_STR(LYDBRTNNAME(LYDB_RTN_SET_MULTI)));
+		}
+		value = (NULL == values) ? &null_ydb_buff : &values[i];
+		if (IS_INVALID_YDB_BUFF_T(value))
+		{
+			char	buff[256];		/* snprintf() buffer */
+
+			SNPRINTF(buff, SIZEOF(buff), "Invalid value (index %d)", i);
+			rts_error_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_PARAMINVALID, 4,
+				LEN_AND_STR(buff), LEN_AND_STR(LYDBRTNNAME(LYDB_RTN_SET_MULTI)));
+		}
+		CHECK_MAX_STR_LEN(value);		/* Generates error is value is too long */
+		/* Same approach as the global variable case in "ydb_set_s" except that the hash of the global name is only
+		 * computed when it differs from that of the previous node and "op_gvname_fast" is driven with it.
+		 */
+		gvname.mvtype = MV_STR;
+		gvname.str.addr = varname->buf_addr + 1;	/* Point past '^' to var name */
+		gvname.str.len = MIN(varname->len_used - 1, MAX_MIDENT_LEN);
+		if ((NULL == prev_varname) || (prev_varname->len_used != varname->len_used)
+				|| memcmp(prev_varname->buf_addr, varname->buf_addr, varname->len_used))
+			COMPUTE_HASH_MSTR(gvname.str, hash_code);
+		plist.arg[0] = (void *)(INTPTR_T)hash_code;
+		plist.arg[1] = &gvname;
+		/* Setup plist (which would point to plist_mvals[] array) for callg invocation of op_gvname_fast */
+		COPY_PARMS_TO_CALLG_BUFFER(nsubs, ((NULL == subsarrays) ? NULL : subsarrays[i]), plist, plist_mvals, FALSE, 2,
+						LYDBRTNNAME(LYDB_RTN_SET_MULTI));
+		callg((callgfnptr)op_gvname_fast, &plist);	/* Drive "op_gvname_fast" to create key */
+		prev_varname = varname;
+		SET_MVAL_FROM_YDB_BUFF_T(&set_value, value);	/* Put value to set into mval for "op_gvput" */
+		INIT_MVAL_BEFORE_USE_IN_M_CODE(&set_value);	/* Do additional initialization of result mval as it could
+								 * be used in database trigger M code (if one gets driven).
+								 */
+		op_gvput(&set_value);				/* Save the global value */
+		REVERT;
+		if (NULL != ret_status)
+			ret_status[i] = YDB_OK;
+	}
+	TREF(sapi_mstrs_for_gc_indx) = 0; /* mstrs in this array (added by RECORD_MSTR_FOR_GC) no longer need to be protected */
+	LIBYOTTADB_DONE;
+	REVERT;
+	return retval;
+}
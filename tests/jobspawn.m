@@ -0,0 +1,67 @@
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+;								;
+; Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	;
+; All rights reserved.						;
+;								;
+;	This source code contains the intellectual property	;
+;	of its copyright holder(s), and is made available	;
+;	under a license.  If you do not know the terms of	;
+;	the license, please stop and do not read further.	;
+;								;
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+jobspawn	; JOB starts the Job process from the middle process (which first cleans up the I/O state it should not pass on)
+	new file,i,ok,x
+	kill ^js
+	; A flat file open in the parent is run down in the middle process and must not be seen by the Job
+	set file="parent.txt"
+	open file:newversion
+	use file
+	write "parent line",!
+	use $principal
+	job child^jobspawn(1,"two"):(output="child.mjo":error="child.mje"):30
+	write "JOB child: $TEST=",$test,!
+	do wait(1)
+	write "child got ",^js(1,"args"),!
+	write "child pid matches $ZJOB: ",(^js(1,"pid")=$zjob),!
+	close file
+	open "child.mjo":readonly
+	use "child.mjo"
+	read x
+	close "child.mjo"
+	write "child.mjo: ",x,!
+	write "child.mje is empty: ",(""=$$first("child.mje")),!
+	write "descriptors of parent.txt open in child: ",$$first("fdcount.txt"),!
+	; A Job whose entryref does not exist fails before it starts running and JOB reports that
+	do bad
+	; Several Jobs at once
+	for i=2:1:4 xecute "job child^jobspawn("_i_",""x"_i_"""):(output=""child"_i_".mjo"":error=""child"_i_".mje""):30"
+	set ok=1
+	for i=2:1:4 do wait(i) set:^js(i,"args")'=(i_" x"_i) ok=0
+	write "3 more Jobs ran: ",ok,!
+	quit
+bad	; the error trap returns to the caller of this label
+	new $etrap
+	set $etrap="write ""JOB nosuchlabel: "",$piece($zstatus,"","",3,99),! set $ecode="""" quit"
+	job nosuchlabel^jobspawn:(output="bad.mjo":error="bad.mje"):30
+	write "JOB nosuchlabel did not fail",!
+	quit
+child(n,arg)
+	set ^js(n,"args")=n_" "_arg,^js(n,"pid")=$job
+	zsystem:1=n "ls -l /proc/"_$job_"/fd | grep -c parent.txt > fdcount.txt"
+	write "child ",n," output",!
+	set ^js(n,"done")=1
+	quit
+wait(n)
+	new i
+	for i=1:1:3000 quit:$data(^js(n,"done"))  hang 0.01
+	if '$data(^js(n,"done")) write "Job ",n," did not finish",!
+	quit
+first(f)
+	new x
+	set x=""
+	open f:readonly
+	use f
+	read:'$zeof x
+	close f
+	use $principal
+	quit x
@@ -0,0 +1,15 @@
+#################################################################
+#								#
+# Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	#
+# All rights reserved.						#
+#								#
+#	This source code contains the intellectual property	#
+#	of its copyright holder(s), and is made available	#
+#	under a license.  If you do not know the terms of	#
+#	the license, please stop and do not read further.	#
+#								#
+#################################################################
+
+# JOB starts the Job with posix_spawnp() from the middle process, which runs down the I/O state of the parent first. Jobs have to
+# run with their parameters and I/O files, and a Job that cannot start has to be reported to the parent.
+"$ydb_dist/yottadb" -run ^jobspawn
@@ -0,0 +1,156 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+/* Exercises ydb_set_multi_s()/ydb_get_multi_s() (or with "st" as argument, ydb_set_multi_st()/ydb_get_multi_st()).
+ * The nodes set here are checked from M by ^multiapi afterwards.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "libyottadb.h"
+
+#define	NNODES		6
+#define	VALUE_SIZE	64
+
+static const char *status_name(int status)
+{
+	static char	buff[32];
+
+	switch (status)
+	{
+		case YDB_OK:
+			return "YDB_OK";
+		case YDB_ERR_GVUNDEF:
+			return "GVUNDEF";
+		case YDB_ERR_PARAMINVALID:
+			return "PARAMINVALID";
+		case YDB_ERR_INVSTRLEN:
+			return "INVSTRLEN";
+		default:
+			snprintf(buff, sizeof(buff), "%d", status);
+			return buff;
+	}
+}
+
+/* Node i of the batch: ^multiapi, ^multiapi("a"), ^multiapi("b",2), ^multiapi2(1), then an entry that is not a global
+ * (and so fails on its own) and finally ^multiapi("c") again to check the batch goes on after that failure.
+ */
+static ydb_buffer_t	varnames[NNODES], subs[NNODES][2];
+static ydb_buffer_t	*subsarrays[NNODES];
+static int		subs_used[NNODES] = {0, 1, 2, 1, 0, 1};
+
+static void init_nodes(void)
+{
+	int	i;
+
+	YDB_LITERAL_TO_BUFFER("^multiapi", &varnames[0]);
+	YDB_LITERAL_TO_BUFFER("^multiapi", &varnames[1]);
+	YDB_LITERAL_TO_BUFFER("a", &subs[1][0]);
+	YDB_LITERAL_TO_BUFFER("^multiapi", &varnames[2]);
+	YDB_LITERAL_TO_BUFFER("b", &subs[2][0]);
+	YDB_LITERAL_TO_BUFFER("2", &subs[2][1]);
+	YDB_LITERAL_TO_BUFFER("^multiapi2", &varnames[3]);
+	YDB_LITERAL_TO_BUFFER("1", &subs[3][0]);
+	YDB_LITERAL_TO_BUFFER("localvar", &varnames[4]);
+	YDB_LITERAL_TO_BUFFER("^multiapi", &varnames[5]);
+	YDB_LITERAL_TO_BUFFER("c", &subs[5][0]);
+	for (i = 0; i < NNODES; i++)
+		subsarrays[i] = subs[i];
+}
+
+static void print_results(const char *what, int ret, const int *ret_status, ydb_buffer_t *ret_values)
+{
+	int	i;
+
+	printf("%s returned %s\n", what, status_name(ret));
+	for (i = 0; i < NNODES; i++)
+	{
+		printf("  node %d : %s", i, status_name(ret_status[i]));
+		if ((NULL != ret_values) && (YDB_OK == ret_status[i]))
+			printf(" : [%.*s]", (int)ret_values[i].len_used, ret_values[i].buf_addr);
+		printf("\n");
+	}
+}
+
+/* A process can only use one of the SimpleAPI and the SimpleThreadAPI so the mode is picked by the first argument */
+static int	use_st;
+static char	errbuf[1024];
+
+static int set_multi(const ydb_buffer_t *values, int *ret_status)
+{
+	ydb_buffer_t	errstr;
+
+	if (!use_st)
+		return ydb_set_multi_s(NNODES, varnames, subs_used, (const ydb_buffer_t *const *)subsarrays, values, ret_status);
+	errstr.buf_addr = errbuf;
+	errstr.len_alloc = sizeof(errbuf);
+	errstr.len_used = 0;
+	return ydb_set_multi_st(YDB_NOTTP, &errstr, NNODES, varnames, subs_used, (const ydb_buffer_t *const *)subsarrays,
+					values, ret_status);
+}
+
+static int get_multi(ydb_buffer_t *ret_values, int *ret_status)
+{
+	ydb_buffer_t	errstr;
+
+	if (!use_st)
+		return ydb_get_multi_s(NNODES, varnames, subs_used, (const ydb_buffer_t *const *)subsarrays, ret_values,
+					ret_status);
+	errstr.buf_addr = errbuf;
+	errstr.len_alloc = sizeof(errbuf);
+	errstr.len_used = 0;
+	return ydb_get_multi_st(YDB_NOTTP, &errstr, NNODES, varnames, subs_used, (const ydb_buffer_t *const *)subsarrays,
+					ret_values, ret_status);
+}
+
+int main(int argc, char *argv[])
+{
+	ydb_buffer_t	values[NNODES], ret_values[NNODES];
+	char		value_bufs[NNODES][VALUE_SIZE];
+	int		ret_status[NNODES], i, ret;
+
+	use_st = (1 < argc) && !strcmp(argv[1], "st");
+	printf("### %s\n", use_st ? "SimpleThreadAPI" : "SimpleAPI");
+	init_nodes();
+	YDB_LITERAL_TO_BUFFER("root", &values[0]);
+	YDB_LITERAL_TO_BUFFER("1", &values[1]);
+	YDB_LITERAL_TO_BUFFER("two", &values[2]);
+	YDB_LITERAL_TO_BUFFER("other global", &values[3]);
+	YDB_LITERAL_TO_BUFFER("not set", &values[4]);
+	if (use_st)
+	{
+		YDB_LITERAL_TO_BUFFER("set by st", &values[5]);
+	} else
+	{
+		YDB_LITERAL_TO_BUFFER("", &values[5]);
+	}
+	ret = set_multi(values, ret_status);
+	print_results("set_multi", ret, ret_status, NULL);
+	/* With no ret_status array, the batch stops at the failing node */
+	ret = set_multi(values, NULL);
+	printf("set_multi without ret_status returned %s\n", status_name(ret));
+	for (i = 0; i < NNODES; i++)
+	{
+		ret_values[i].buf_addr = value_bufs[i];
+		ret_values[i].len_alloc = VALUE_SIZE;
+		ret_values[i].len_used = 0;
+	}
+	ret = get_multi(ret_values, ret_status);
+	print_results("get_multi", ret, ret_status, ret_values);
+	/* A node that does not exist and a buffer that is too small fail on their own */
+	YDB_LITERAL_TO_BUFFER("nosuchnode", &subs[5][0]);
+	ret_values[2].len_alloc = 2;
+	ret = get_multi(ret_values, ret_status);
+	print_results("get_multi with a missing node and a short buffer", ret, ret_status, ret_values);
+	return 0;
+}
@@ -0,0 +1,19 @@
+#################################################################
+#								#
+# Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	#
+# All rights reserved.						#
+#								#
+#	This source code contains the intellectual property	#
+#	of its copyright holder(s), and is made available	#
+#	under a license.  If you do not know the terms of	#
+#	the license, please stop and do not read further.	#
+#								#
+#################################################################
+
+# ydb_set_multi_s()/ydb_get_multi_s() and the SimpleThreadAPI variants (each in its own process as the two APIs cannot be
+# mixed in one process), followed by a check from M of what they stored.
+${CC:-cc} $cflags -o multiapi "$testdir/multiapi.c" $ldflags || exit 1
+./multiapi
+"$ydb_dist/yottadb" -run ^multiapi
+./multiapi st
+"$ydb_dist/yottadb" -run ^multiapi
@@ -0,0 +1,134 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+/* Walks ^nn (set up by ^nodenextmulti) in batches with ydb_node_next_multi_s() (or with "st" as argument,
+ * ydb_node_next_multi_st()), once fetching the values and once without them.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "libyottadb.h"
+
+#define	MAX_BATCH	4
+#define	MAX_SUBS	3
+#define	BUFF_SIZE	64
+
+static int	use_st;
+static char	errbuf[1024];
+
+static const char *status_name(int status)
+{
+	static char	buff[32];
+
+	switch (status)
+	{
+		case YDB_OK:
+			return "YDB_OK";
+		case YDB_ERR_NODEEND:
+			return "NODEEND";
+		case YDB_ERR_PARAMINVALID:
+			return "PARAMINVALID";
+		default:
+			snprintf(buff, sizeof(buff), "%d", status);
+			return buff;
+	}
+}
+
+static int node_next_multi(ydb_buffer_t *varname, int subs_used, ydb_buffer_t *subsarray, int max_nodes, int *ret_count,
+				int *ret_subs_used, ydb_buffer_t *const *ret_subsarrays, ydb_buffer_t *ret_values)
+{
+	ydb_buffer_t	errstr;
+
+	if (!use_st)
+		return ydb_node_next_multi_s(varname, subs_used, subsarray, max_nodes, ret_count, ret_subs_used,
+						ret_subsarrays, ret_values);
+	errstr.buf_addr = errbuf;
+	errstr.len_alloc = sizeof(errbuf);
+	errstr.len_used = 0;
+	return ydb_node_next_multi_st(YDB_NOTTP, &errstr, varname, subs_used, subsarray, max_nodes, ret_count, ret_subs_used,
+					ret_subsarrays, ret_values);
+}
+
+/* Returns the nodes of ^nn "batch" at a time, each call starting from the last node returned by the previous one */
+static void walk(int batch, int with_values)
+{
+	ydb_buffer_t	varname, start[MAX_SUBS], subs[MAX_BATCH][MAX_SUBS], *subsarrays[MAX_BATCH], values[MAX_BATCH];
+	char		start_bufs[MAX_SUBS][BUFF_SIZE], subs_bufs[MAX_BATCH][MAX_SUBS][BUFF_SIZE];
+	char		value_bufs[MAX_BATCH][BUFF_SIZE];
+	int		start_used, ret_subs_used[MAX_BATCH], ret_count, ret, i, j, calls;
+
+	printf("walk in batches of %d %s values\n", batch, with_values ? "with" : "without");
+	YDB_LITERAL_TO_BUFFER("^nn", &varname);
+	for (i = 0; i < MAX_BATCH; i++)
+	{
+		subsarrays[i] = subs[i];
+		for (j = 0; j < MAX_SUBS; j++)
+		{
+			subs[i][j].buf_addr = subs_bufs[i][j];
+			subs[i][j].len_alloc = BUFF_SIZE;
+		}
+		values[i].buf_addr = value_bufs[i];
+		values[i].len_alloc = BUFF_SIZE;
+	}
+	for (j = 0; j < MAX_SUBS; j++)
+	{
+		start[j].buf_addr = start_bufs[j];
+		start[j].len_alloc = BUFF_SIZE;
+	}
+	start_used = 0;
+	for (calls = 1; ; calls++)
+	{
+		for (i = 0; i < batch; i++)
+			ret_subs_used[i] = MAX_SUBS;
+		ret = node_next_multi(&varname, start_used, start, batch, &ret_count, ret_subs_used, subsarrays,
+					with_values ? values : NULL);
+		printf(" call %d returned %s with %d nodes\n", calls, status_name(ret), ret_count);
+		for (i = 0; i < ret_count; i++)
+		{
+			printf("  ^nn(");
+			for (j = 0; j < ret_subs_used[i]; j++)
+				printf("%s%.*s", j ? "," : "", (int)subs[i][j].len_used, subs[i][j].buf_addr);
+			printf(")");
+			if (with_values)
+				printf("=[%.*s]", (int)values[i].len_used, values[i].buf_addr);
+			printf("\n");
+		}
+		if ((YDB_OK != ret) || (0 == ret_count))
+			break;
+		/* The next call starts from the last node returned by this one */
+		start_used = ret_subs_used[ret_count - 1];
+		for (j = 0; j < start_used; j++)
+		{
+			memcpy(start[j].buf_addr, subs[ret_count - 1][j].buf_addr, subs[ret_count - 1][j].len_used);
+			start[j].len_used = subs[ret_count - 1][j].len_used;
+		}
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	ydb_buffer_t	varname;
+	int		ret_count, ret_subs_used[1], ret;
+
+	use_st = (1 < argc) && !strcmp(argv[1], "st");
+	printf("### %s\n", use_st ? "SimpleThreadAPI" : "SimpleAPI");
+	walk(3, 1);
+	walk(4, 0);
+	walk(1, 1);
+	/* Local variables are not supported */
+	YDB_LITERAL_TO_BUFFER("nn", &varname);
+	ret_subs_used[0] = 0;
+	ret = node_next_multi(&varname, 0, NULL, 1, &ret_count, ret_subs_used, NULL, NULL);
+	printf("local variable returned %s\n", status_name(ret));
+	return 0;
+}
@@ -0,0 +1,26 @@
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+;								;
+; Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	;
+; All rights reserved.						;
+;								;
+;	This source code contains the intellectual property	;
+;	of its copyright holder(s), and is made available	;
+;	under a license.  If you do not know the terms of	;
+;	the license, please stop and do not read further.	;
+;								;
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+nodenextmulti	; Set up and show from M the global the nodenextmulti C driver walks
+	quit
+setup	;
+	kill ^nn
+	set ^nn="root",^nn(1)="one",^nn(1,"a")="one a",^nn(2)=2,^nn("x")="",^nn("x",1,2)="deep",^nn("y")="y"
+	quit
+verify	; Print the nodes following ^nn the same way as the C driver does
+	new node,i
+	write "### M view",!
+	set node="^nn"
+	for  set node=$query(@node) quit:""=node  do
+	. write "  ^nn("
+	. for i=1:1:$qlength(node) write $select(1<i:",",1:""),$qsubscript(node,i)
+	. write ")=[",@node,"]",!
+	quit
@@ -0,0 +1,19 @@
+#################################################################
+#								#
+# Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	#
+# All rights reserved.						#
+#								#
+#	This source code contains the intellectual property	#
+#	of its copyright holder(s), and is made available	#
+#	under a license.  If you do not know the terms of	#
+#	the license, please stop and do not read further.	#
+#								#
+#################################################################
+
+# ydb_node_next_multi_s() and ydb_node_next_multi_st() (each in its own process as the two APIs cannot be mixed in one
+# process) walking a global in batches of different sizes, checked against a $QUERY walk from M.
+${CC:-cc} $cflags -o nodenextmulti "$testdir/nodenextmulti.c" $ldflags || exit 1
+"$ydb_dist/yottadb" -run setup^nodenextmulti
+"$ydb_dist/yottadb" -run verify^nodenextmulti
+./nodenextmulti
+./nodenextmulti st
@@ -0,0 +1,35 @@
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+;								;
+; Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	;
+; All rights reserved.						;
+;								;
+;	This source code contains the intellectual property	;
+;	of its copyright holder(s), and is made available	;
+;	under a license.  If you do not know the terms of	;
+;	the license, please stop and do not read further.	;
+;								;
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+reorgbackoff	; Data for the reorgbackoff test
+	quit
+setup	; Fill ^rb and then kill most of it so that REORG has blocks to coalesce and swap
+	new i
+	kill ^rb,^rbstop
+	for i=1:1:20000 set ^rb(i)=$justify(i,200)
+	for i=1:1:20000 kill:i#5 ^rb(i)
+	quit
+verify	; Print a summary of the numeric nodes of ^rb that does not depend on how its blocks are laid out
+	new i,n,sum,len
+	set (n,sum,len)=0
+	set i="" for  set i=$order(^rb(i)) quit:(""=i)!(i'=+i)  do
+	. set n=n+1,sum=sum+i,len=len+$length(^rb(i))
+	. if ^rb(i)'=$justify(i,200) write "bad value in ^rb(",i,")",!
+	write "nodes ",n," sum of subscripts ",sum," total value length ",len,!
+	quit
+update	; Keep updating ^rb("u",...) (in the same blocks REORG works on) until ^rbstop is set
+	new i
+	set ^rbstop=0
+	for i=1:1 quit:^rbstop  set ^rb("u",i#500)=$justify(i,200) kill:'(i#7) ^rb("u",i#500\2)
+	quit
+stop	; Tell "update" to stop
+	set ^rbstop=1
+	quit
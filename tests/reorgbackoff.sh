@@ -0,0 +1,47 @@
+#################################################################
+#								#
+# Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	#
+# All rights reserved.						#
+#								#
+#	This source code contains the intellectual property	#
+#	of its copyright holder(s), and is made available	#
+#	under a license.  If you do not know the terms of	#
+#	the license, please stop and do not read further.	#
+#								#
+#################################################################
+
+# MUPIP REORG -BACKOFF -PROGRESS on a sparse global, checked with MUPIP INTEG and by comparing the data before and after.
+# A REORG sleep is set in the file header so REORG runs long enough to report progress. How many progress lines show
+# up and the numbers in them depend on timing so only their format is checked. With no other process in the region,
+# -BACKOFF adds nothing to that sleep. A second REORG runs while another process updates the same global.
+progress_re='^Global: rb (region DEFAULT) : blocks processed [0-9]* : blocks/second [0-9]* : sleep [0-9]* nsec$'
+check_progress()
+{
+	grep -c "^Global: rb (region DEFAULT)$" reorg.out
+	echo "progress reported: $(grep -q ' : blocks processed ' reorg.out && echo yes || echo no)"
+	echo "badly formatted progress lines: $(grep ' : blocks processed ' reorg.out | grep -cv "$progress_re")"
+	echo "sleeps shorter than the file header REORG sleep: $(grep "$progress_re" reorg.out \
+		| awk '{if ($(NF - 1) < 10000000) n++} END {print n + 0}')"
+}
+"$ydb_dist/mupip" set -region DEFAULT -reorg_sleep_nsec=10000000 > set.out 2>&1 || cat set.out
+"$ydb_dist/yottadb" -run setup^reorgbackoff
+"$ydb_dist/yottadb" -run verify^reorgbackoff
+"$ydb_dist/mupip" reorg -backoff -progress=1 -fill_factor=100 -select="rb" > reorg.out 2>&1
+echo "reorg exit status $?"
+check_progress
+echo "sleeps other than the file header REORG sleep: $(grep "$progress_re" reorg.out | grep -cv ' : sleep 10000000 nsec$')"
+"$ydb_dist/yottadb" -run verify^reorgbackoff
+"$ydb_dist/yottadb" -run setup^reorgbackoff
+"$ydb_dist/yottadb" -run update^reorgbackoff &
+updater=$!
+"$ydb_dist/mupip" reorg -backoff -progress=1 -fill_factor=100 -select="rb" > reorg.out 2>&1
+echo "reorg with a concurrent updater exit status $?"
+"$ydb_dist/yottadb" -run stop^reorgbackoff
+wait $updater
+check_progress
+"$ydb_dist/yottadb" -run verify^reorgbackoff
+"$ydb_dist/mupip" integ -region DEFAULT > integ.out 2>&1
+echo "integ exit status $?"
+grep "^No errors detected by integ.$" integ.out
+# A -PROGRESS interval has to be positive
+"$ydb_dist/mupip" reorg -progress=0 -select="rb" 2>&1 | grep "PROGRESS"
@@ -0,0 +1,61 @@
+#!/bin/sh
+
+#################################################################
+#								#
+# Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	#
+# All rights reserved.						#
+#								#
+#	This source code contains the intellectual property	#
+#	of its copyright holder(s), and is made available	#
+#	under a license.  If you do not know the terms of	#
+#	the license, please stop and do not read further.	#
+#								#
+#################################################################
+
+# Runs the regression tests in this directory (all of them or the ones named as arguments) against the YottaDB
+# installed in $ydb_dist. See README.md for how a test is laid out.
+
+if [ -z "$ydb_dist" ] || [ ! -x "$ydb_dist/yottadb" ]; then
+	echo "ydb_dist must point to a YottaDB installation"
+	exit 1
+fi
+testdir=$(cd "$(dirname "$0")" && pwd)
+export ydb_dist testdir
+export cflags="-I$ydb_dist"
+export ldflags="-L$ydb_dist -lyottadb -Wl,-rpath,$ydb_dist"
+unset ydb_app_ensures_isolation ydb_gbldir ydb_routines ydb_chset ydb_local_collate ydb_lct_stdnull ydb_zquit_anyway
+unset gtmgbldir gtmroutines gtm_chset
+
+if [ 0 -eq $# ]; then
+	set -- $(cd "$testdir" && ls *.sh | grep -v '^run_tests.sh$' | sed 's/\.sh$//')
+fi
+nfail=0
+for name in "$@"; do
+	if [ ! -f "$testdir/$name.sh" ] || [ ! -f "$testdir/$name.ref" ]; then
+		echo "FAIL $name (no such test)"
+		nfail=$((nfail + 1))
+		continue
+	fi
+	scratch=$(mktemp -d "${TMPDIR:-/tmp}/ydbtest_$name.XXXXXX")
+	(
+		cd "$scratch" || exit 1
+		export ydb_gbldir="$scratch/mumps.gld"
+		export ydb_routines="$scratch($testdir) $ydb_dist/libyottadbutil.so"
+		"$ydb_dist/yottadb" -run GDE exit > gde.log 2>&1 || exit 1
+		"$ydb_dist/mupip" create > create.log 2>&1 || exit 1
+		sh "$testdir/$name.sh" > "$name.log" 2>&1
+		# Without /dev/log (e.g. in a container), syslog messages are echoed to stderr. They carry pids and depend on
+		# timing so leave them out of the comparison.
+		grep -v '^YDB-[A-Z_]*\[[0-9]*\]: ' "$name.log" > "$name.out"
+		diff "$testdir/$name.ref" "$name.out" > "$name.diff"
+	)
+	if [ 0 -eq $? ]; then
+		echo "PASS $name"
+		rm -rf "$scratch"
+	else
+		echo "FAIL $name (see $scratch)"
+		cat "$scratch/$name.diff" 2>/dev/null
+		nfail=$((nfail + 1))
+	fi
+done
+[ 0 -eq $nfail ]
@@ -0,0 +1,43 @@
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+;								;
+; Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	;
+; All rights reserved.						;
+;								;
+;	This source code contains the intellectual property	;
+;	of its copyright holder(s), and is made available	;
+;	under a license.  If you do not know the terms of	;
+;	the license, please stop and do not read further.	;
+;								;
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+socketepoll	; WRITE /WAIT on a SOCKET device that is past $ydb_socket_epoll_threshold and so waits with epoll
+	new c1,c2,cli,i,key,srv,start
+	set srv="server",cli="client"
+	open srv:(LISTEN="socketepoll.sock:LOCAL":ATTACH="listener"):5:"SOCKET"
+	else  write "cannot listen",! quit
+	open cli:(CONNECT="socketepoll.sock:LOCAL":ATTACH="c1"):5:"SOCKET"
+	else  write "cannot connect c1",! quit
+	open cli:(CONNECT="socketepoll.sock:LOCAL":ATTACH="c2"):5:"SOCKET"
+	else  write "cannot connect c2",! quit
+	use srv
+	for i=1:1:2 write /wait(5) set key(i)=$key
+	use $principal
+	for i=1:1:2 write "accept ",i,": ",$piece(key(i),"|",1),!
+	; Output is blocking so a WRITE only wait has nothing to wait for on any socket (the listener included) and must
+	; time out rather than call epoll_wait() with no epoll set (this is the first wait with all 3 sockets).
+	use srv
+	set start=$zut
+	write /wait(1,"WRITE")
+	set key=$key,i=$test
+	use $principal
+	write "WRITE wait: $TEST=",i," $KEY=""",key,"""",!
+	write "WRITE wait timed out after ",$select($zut-start>=900000:"at least",1:"less than")," its 1 second timeout",!
+	; Data sent from c2 makes its server side socket, which is registered for EPOLLIN, readable
+	use cli:(SOCKET="c2")
+	write "x",!
+	use srv
+	write /wait(5,"READ")
+	set key=$key,i=$test
+	use $principal
+	write "READ wait: $TEST=",i," $KEY event=",$piece(key,"|",1),!
+	close cli,srv
+	quit
@@ -0,0 +1,16 @@
+#################################################################
+#								#
+# Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	#
+# All rights reserved.						#
+#								#
+#	This source code contains the intellectual property	#
+#	of its copyright holder(s), and is made available	#
+#	under a license.  If you do not know the terms of	#
+#	the license, please stop and do not read further.	#
+#								#
+#################################################################
+
+# A WRITE /WAIT on a SOCKET device with blocking output has no event to wait for on any of its sockets. With epoll
+# in use ($ydb_socket_epoll_threshold at or below the number of sockets) that must still honor the timeout. The device
+# only reaches 3 sockets after the accepts, so that wait is the first to use epoll and finds nothing registered.
+ydb_socket_epoll_threshold=3 "$ydb_dist/yottadb" -run ^socketepoll
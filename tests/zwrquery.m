@@ -0,0 +1,41 @@
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+;								;
+; Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	;
+; All rights reserved.						;
+;								;
+;	This source code contains the intellectual property	;
+;	of its copyright holder(s), and is made available	;
+;	under a license.  If you do not know the terms of	;
+;	the license, please stop and do not read further.	;
+;								;
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+zwrquery	; ZWRITE of a whole global (which walks it in $QUERY order) compared with the subscript level walk
+	new a,b,f1,f2,l1,l2,n1,ok
+	kill ^zq
+	set ^zq="root",^zq(-1.5)="neg",^zq(0)=0,^zq(.5)="half",^zq(1)="one",^zq(1,"a")="one a",^zq(1,"a",2)=12
+	set ^zq(2,"deep",3,4)="only a descendant at 2",^zq(10)="ten",^zq("A")="upper",^zq("a")="a"_$char(0)_"b"
+	set ^zq("q")="say ""hi""",^zq("x",$char(1))=$char(1,2)
+	zwrite ^zq
+	; ZWRITE ^zq(:,*) writes every node but the root through the subscript level walk and must write the same lines.
+	; The $ORDER count shows which walk each ZWRITE took.
+	set f1="zq1.txt",f2="zq2.txt"
+	open f1:(newversion) use f1 do stats(.b) zwrite ^zq do stats(.a) close f1
+	use $principal write "ZWRITE ^zq did ",a("ORD")-b("ORD")," $ORDER operations",!
+	open f2:(newversion) use f2 do stats(.b) zwrite ^zq(:,*) do stats(.a) close f2
+	use $principal write "ZWRITE ^zq(:,*) did ",a("ORD")-b("ORD")," $ORDER operations",!
+	open f1:(readonly),f2:(readonly)
+	use f1 read l1	; skip the root node
+	set n1=0,ok=1
+	for  do  quit:'ok!(""=l1)
+	. use f1 read l1 set:$zeof l1="" set:""'=l1 n1=n1+1
+	. use f2 read l2 set:$zeof l2="" set:l1'=l2 ok=0
+	close f1,f2
+	use $principal
+	write "ZWRITE ^zq and ZWRITE ^zq(:,*) ",$select(ok:"match",1:"differ at line "_n1)," (",n1," nodes below the root)",!
+	quit
+stats(s)	; Return the database statistics of the DEFAULT region in s(<counter name>)
+	new i,x
+	kill s
+	set x=$view("GVSTATS","DEFAULT")
+	for i=1:1:$length(x,",") set s($piece($piece(x,",",i),":",1))=$piece($piece(x,",",i),":",2)
+	quit
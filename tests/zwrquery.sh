@@ -0,0 +1,15 @@
+#################################################################
+#								#
+# Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	#
+# All rights reserved.						#
+#								#
+#	This source code contains the intellectual property	#
+#	of its copyright holder(s), and is made available	#
+#	under a license.  If you do not know the terms of	#
+#	the license, please stop and do not read further.	#
+#								#
+#################################################################
+
+# ZWRITE of a whole global, which walks it in $QUERY order with one database search per node, has to write the same
+# lines as the subscript level walk that ZWRITE with subscripts still does. The $ORDER counts show which walk was taken.
+"$ydb_dist/yottadb" -run ^zwrquery